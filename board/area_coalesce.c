@@ -0,0 +1,75 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "area_coalesce.h"
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+void DEMO_FitAreaCost(demo_area_cost_t *cost,
+                      uint32_t smallPixels,
+                      uint32_t smallCycles,
+                      uint32_t largePixels,
+                      uint32_t largeCycles)
+{
+    uint32_t smallPixelCycles;
+
+    assert(largePixels > smallPixels);
+
+    cost->pixelCycles256 = (largeCycles > smallCycles) ?
+                               (uint32_t)(((uint64_t)(largeCycles - smallCycles) << 8U) / (largePixels - smallPixels)) :
+                               0U;
+    smallPixelCycles  = (uint32_t)(((uint64_t)cost->pixelCycles256 * smallPixels) >> 8U);
+    cost->fixedCycles = (smallCycles > smallPixelCycles) ? (smallCycles - smallPixelCycles) : 0U;
+}
+
+uint32_t DEMO_GetAreaCost(const demo_area_cost_t *cost, const demo_area_t *area)
+{
+    uint64_t pixels = (uint64_t)(uint32_t)(area->x2 - area->x1 + 1) * (uint32_t)(area->y2 - area->y1 + 1);
+
+    return cost->fixedCycles + (uint32_t)((pixels * cost->pixelCycles256) >> 8U);
+}
+
+uint32_t DEMO_CoalesceAreas(const demo_area_cost_t *cost, demo_area_t *areas, uint32_t count)
+{
+    demo_area_t joined;
+    bool merged;
+
+    /*
+     * A larger area could be merged with the areas checked before, so repeat
+     * until a pass merges nothing.
+     */
+    do
+    {
+        merged = false;
+
+        for (uint32_t i = 0U; i < count; i++)
+        {
+            for (uint32_t j = i + 1U; j < count; j++)
+            {
+                joined.x1 = MIN(areas[i].x1, areas[j].x1);
+                joined.y1 = MIN(areas[i].y1, areas[j].y1);
+                joined.x2 = MAX(areas[i].x2, areas[j].x2);
+                joined.y2 = MAX(areas[i].y2, areas[j].y2);
+
+                if (DEMO_GetAreaCost(cost, &joined) <=
+                    (DEMO_GetAreaCost(cost, &areas[i]) + DEMO_GetAreaCost(cost, &areas[j])))
+                {
+                    areas[i] = joined;
+                    areas[j] = areas[--count];
+                    merged   = true;
+
+                    /* The area is larger now, check all the others after it again. */
+                    j = i;
+                }
+            }
+        }
+    } while (merged);
+
+    return count;
+}
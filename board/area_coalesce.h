@@ -0,0 +1,86 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _AREA_COALESCE_H_
+#define _AREA_COALESCE_H_
+
+#include "fsl_common.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Area with inclusive coordinates, the same as the LVGL area. */
+typedef struct _demo_area
+{
+    int32_t x1; /*!< Left. */
+    int32_t y1; /*!< Top. */
+    int32_t x2; /*!< Right, inclusive. */
+    int32_t y2; /*!< Bottom, inclusive. */
+} demo_area_t;
+
+/*! @brief Cost to process one area, in CPU cycles. */
+typedef struct _demo_area_cost
+{
+    uint32_t fixedCycles;    /*!< Cost per area. */
+    uint32_t pixelCycles256; /*!< Cost per pixel, in 1/256 cycle. */
+} demo_area_cost_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * @brief Fit the area cost to two measured areas.
+ *
+ * The fixed cost and the pixel cost are the line through the two points. The
+ * costs are never negative, a measurement noise gives 0 instead.
+ *
+ * @param cost Output cost.
+ * @param smallPixels Pixels of the small area.
+ * @param smallCycles CPU cycles to process the small area.
+ * @param largePixels Pixels of the large area, more than @p smallPixels.
+ * @param largeCycles CPU cycles to process the large area.
+ */
+void DEMO_FitAreaCost(demo_area_cost_t *cost,
+                      uint32_t smallPixels,
+                      uint32_t smallCycles,
+                      uint32_t largePixels,
+                      uint32_t largeCycles);
+
+/*!
+ * @brief Get the cost to process an area.
+ *
+ * @param cost Area cost.
+ * @param area The area, it must not be empty.
+ * @return The cost in CPU cycles.
+ */
+uint32_t DEMO_GetAreaCost(const demo_area_cost_t *cost, const demo_area_t *area);
+
+/*!
+ * @brief Merge the areas whose bounding area costs less than they do.
+ *
+ * Two areas are replaced with their bounding area if it is not more costly,
+ * until no more areas could be merged. Every pixel of the input areas is in the
+ * output areas, and the total cost never increases. The pixels added by the
+ * bounding areas are processed again, the caller must make it harmless.
+ *
+ * @param cost Area cost.
+ * @param areas The areas, merged in place.
+ * @param count Number of areas.
+ * @return Number of areas after merging, not more than @p count.
+ */
+uint32_t DEMO_CoalesceAreas(const demo_area_cost_t *cost, demo_area_t *areas, uint32_t count);
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+#endif /* _AREA_COALESCE_H_ */
@@ -0,0 +1,81 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "beam_race.h"
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+int32_t DEMO_BeamGetScanLine(const demo_beam_timing_t *timing, uint32_t vsyncCycle, uint32_t vsyncPeriod, uint32_t now)
+{
+    uint32_t totalLines = timing->blankLines + timing->activeLines;
+    uint32_t line;
+
+    /* Not measured yet, treat as all rows passed. */
+    if (vsyncPeriod == 0U)
+    {
+        return (int32_t)timing->activeLines;
+    }
+
+    line = (uint32_t)((uint64_t)(now - vsyncCycle) * totalLines / vsyncPeriod);
+
+    /* Vertical blanking interrupt delayed. */
+    line %= totalLines;
+
+    return (int32_t)line - (int32_t)timing->blankLines;
+}
+
+uint32_t DEMO_BeamGetWaitCycles(const demo_beam_timing_t *timing,
+                                uint32_t vsyncCycle,
+                                uint32_t vsyncPeriod,
+                                uint32_t now,
+                                int32_t firstRow,
+                                int32_t lastRow)
+{
+    uint32_t totalLines = timing->blankLines + timing->activeLines;
+    uint32_t bandLines  = (uint32_t)(lastRow - firstRow + 1);
+    int32_t beam        = DEMO_BeamGetScanLine(timing, vsyncCycle, vsyncPeriod, now);
+    uint32_t scanned;
+    uint32_t first;
+    uint32_t last;
+    uint32_t waitLines;
+
+    if (vsyncPeriod == 0U)
+    {
+        return 0U;
+    }
+
+    /* Lines scanned since row 0, the vertical blanking comes after the last row. */
+    scanned = (beam < 0) ? ((uint32_t)(beam + (int32_t)totalLines)) : (uint32_t)beam;
+
+    /*
+     * The band is written when the scanout has passed its last row, and before
+     * the scanout comes back to its first row in the next frame, the copy takes
+     * at most the band scanout time. Don't write ahead of the scanout even if it
+     * is far above the band: the band would be shown in this frame, but the
+     * bands above it in the next. The estimation error is within the margin on
+     * both sides, so the window ends the margin before the next frame.
+     */
+    first = (uint32_t)lastRow + DEMO_BEAM_MARGIN_LINES + 1U;
+    last  = totalLines - 1U - DEMO_BEAM_MARGIN_LINES;
+    if (((uint32_t)firstRow + totalLines) < (bandLines + DEMO_BEAM_MARGIN_LINES + last))
+    {
+        last = (uint32_t)firstRow + totalLines - bandLines - DEMO_BEAM_MARGIN_LINES;
+    }
+
+    if ((scanned >= first) && (scanned <= last))
+    {
+        return 0U;
+    }
+
+    /* Wait for the window in this frame, or in the next frame if it is missed. */
+    waitLines = (scanned < first) ? (first - scanned) : (totalLines - scanned + first);
+
+    /* Round up, so the scanout is in the window when checked again. */
+    return (uint32_t)(((uint64_t)waitLines * vsyncPeriod + totalLines - 1U) / totalLines);
+}
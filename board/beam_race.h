@@ -0,0 +1,87 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _BEAM_RACE_H_
+#define _BEAM_RACE_H_
+
+#include "fsl_common.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*
+ * Error of the estimated scanout position in lines. The vertical blanking
+ * timestamp is taken late by the interrupt latency, and the period measured
+ * between two interrupts jitters with it, so the estimated row could be a little
+ * behind or ahead of the real one.
+ */
+#ifndef DEMO_BEAM_MARGIN_LINES
+#define DEMO_BEAM_MARGIN_LINES 2
+#endif
+
+/*! @brief Vertical timing of the scanout, in lines. */
+typedef struct _demo_beam_timing
+{
+    uint32_t activeLines; /*!< Rows scanned out, the panel height. */
+    uint32_t blankLines;  /*!< Lines of front porch, sync and back porch. */
+} demo_beam_timing_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * @brief Estimate the row being scanned out.
+ *
+ * The vertical blanking interrupt comes after the last active line, then the
+ * front porch, sync and back porch lines are sent before row 0. The scanout
+ * position is estimated from the time since the last interrupt.
+ *
+ * @param timing Vertical timing of the scanout.
+ * @param vsyncCycle CPU cycle count at the last vertical blanking interrupt.
+ * @param vsyncPeriod Vertical blanking period in CPU cycles, 0 if not measured yet.
+ * @param now Current CPU cycle count.
+ * @return The row being scanned out, negative in the vertical blanking. If the
+ * period is not measured yet, @ref demo_beam_timing_t::activeLines is returned,
+ * as if all rows are passed.
+ */
+int32_t DEMO_BeamGetScanLine(const demo_beam_timing_t *timing, uint32_t vsyncCycle, uint32_t vsyncPeriod, uint32_t now);
+
+/*!
+ * @brief Get how long to wait before a band could be written.
+ *
+ * A band is only written after the scanout passed its last row, and all rows
+ * are passed in the vertical blanking. The copy must end before the scanout
+ * comes back to the band, it is assumed to take no longer than the scanout of
+ * the band. So the band is shown in the next frame and never scanned out half
+ * written.
+ *
+ * @param timing Vertical timing of the scanout.
+ * @param vsyncCycle CPU cycle count at the last vertical blanking interrupt.
+ * @param vsyncPeriod Vertical blanking period in CPU cycles, 0 if not measured yet.
+ * @param now Current CPU cycle count.
+ * @param firstRow First row of the band.
+ * @param lastRow Last row of the band.
+ * @return 0 if the band could be written now, otherwise the CPU cycles until
+ * it could be written, then the caller checks again.
+ */
+uint32_t DEMO_BeamGetWaitCycles(const demo_beam_timing_t *timing,
+                                uint32_t vsyncCycle,
+                                uint32_t vsyncPeriod,
+                                uint32_t now,
+                                int32_t firstRow,
+                                int32_t lastRow);
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+#endif /* _BEAM_RACE_H_ */
@@ -432,22 +432,24 @@ void BOARD_ConfigMPU(void)
     MPU->RBAR = ARM_MPU_RBAR(11, 0x40000000);
     MPU->RASR = ARM_MPU_RASR(0, ARM_MPU_AP_FULL, 2, 0, 0, 0, 0, ARM_MPU_REGION_SIZE_16MB);
 
-    /* Region 12 setting: Memory with Device type, not shareable, non-cacheable */
+    /*
+     * Region 12 setting: Memory with Device type, not shareable, non-cacheable.
+     * 0x41000000 ~ 0x411FFFFF and 0x41400000 ~ 0x414FFFFF, other 1MB sub-regions are disabled.
+     */
     MPU->RBAR = ARM_MPU_RBAR(12, 0x41000000);
-    MPU->RASR = ARM_MPU_RASR(0, ARM_MPU_AP_FULL, 2, 0, 0, 0, 0, ARM_MPU_REGION_SIZE_2MB);
+    MPU->RASR = ARM_MPU_RASR(0, ARM_MPU_AP_FULL, 2, 0, 0, 0, 0xEC, ARM_MPU_REGION_SIZE_8MB);
 
     /* Region 13 setting: Memory with Device type, not shareable, non-cacheable */
-    MPU->RBAR = ARM_MPU_RBAR(13, 0x41400000);
-    MPU->RASR = ARM_MPU_RASR(0, ARM_MPU_AP_FULL, 2, 0, 0, 0, 0, ARM_MPU_REGION_SIZE_1MB);
-
-    /* Region 14 setting: Memory with Device type, not shareable, non-cacheable */
-    MPU->RBAR = ARM_MPU_RBAR(14, 0x41800000);
+    MPU->RBAR = ARM_MPU_RBAR(13, 0x41800000);
     MPU->RASR = ARM_MPU_RASR(0, ARM_MPU_AP_FULL, 2, 0, 0, 0, 0, ARM_MPU_REGION_SIZE_2MB);
 
-    /* Region 15 setting: Memory with Device type, not shareable, non-cacheable */
-    MPU->RBAR = ARM_MPU_RBAR(15, 0x42000000);
+    /* Region 14 setting: Memory with Device type, not shareable, non-cacheable */
+    MPU->RBAR = ARM_MPU_RBAR(14, 0x42000000);
     MPU->RASR = ARM_MPU_RASR(0, ARM_MPU_AP_FULL, 2, 0, 0, 0, 0, ARM_MPU_REGION_SIZE_1MB);
 
+    /* Region 15 is configured by BOARD_ConfigFrameBufferMPU. */
+    ARM_MPU_ClrRegion(BOARD_FRAME_BUFFER_MPU_REGION);
+
     /* Enable MPU */
     ARM_MPU_Enable(MPU_CTRL_PRIVDEFENA_Msk | MPU_CTRL_HFNMIENA_Msk);
 
@@ -459,6 +461,82 @@ void BOARD_ConfigMPU(void)
     SCB_EnableICache();
 #endif
 }
+
+void BOARD_ConfigFrameBufferMPU(uint32_t address, uint32_t size, bool writeThrough)
+{
+    uint32_t endAddr = address + size - 1U;
+    uint32_t i       = 5U;
+    uint32_t regionBase;
+    uint32_t subRegionSize;
+    uint32_t subRegionStart;
+    uint8_t subRegionDisable = 0U;
+    uint32_t primask;
+
+    assert(size > 0U);
+
+    /* Find the smallest 2^N size region which contains the whole buffer, 5<=N<=32. */
+    while ((address >> i) != (endAddr >> i))
+    {
+        i++;
+        assert(i < 32U);
+    }
+
+    regionBase = address & ~((1UL << i) - 1U);
+
+    /*
+     * Region not less than 256 bytes has 8 sub-regions, only the ones inside the
+     * buffer are enabled. A sub-region partly out of the buffer would change the
+     * policy of other memory, and disabling it would leave part of the buffer
+     * with the old policy, so the buffer must fill whole sub-regions.
+     */
+    if (i >= 8U)
+    {
+        subRegionSize = 1UL << (i - 3U);
+
+        assert((address & (subRegionSize - 1U)) == 0U);
+        assert((size & (subRegionSize - 1U)) == 0U);
+
+        for (uint8_t j = 0U; j < 8U; j++)
+        {
+            subRegionStart = regionBase + j * subRegionSize;
+
+            if ((subRegionStart < address) || (subRegionStart + subRegionSize - 1U > endAddr))
+            {
+                subRegionDisable |= (uint8_t)(1U << j);
+            }
+        }
+    }
+    else
+    {
+        /* No sub-region, the region must be the buffer. */
+        assert((regionBase == address) && (size == (1UL << i)));
+    }
+
+    primask = DisableGlobalIRQ();
+
+    /* No dirty line should be left with the old cache policy. */
+#if defined(__DCACHE_PRESENT) && __DCACHE_PRESENT
+    SCB_CleanInvalidateDCache();
+#endif
+
+    if (writeThrough)
+    {
+        /* Memory with Normal type, not shareable, write through, no write allocate */
+        MPU->RBAR = ARM_MPU_RBAR(BOARD_FRAME_BUFFER_MPU_REGION, regionBase);
+        MPU->RASR = ARM_MPU_RASR(0, ARM_MPU_AP_FULL, 0, 0, 1, 0, subRegionDisable, i - 1U);
+    }
+    else
+    {
+        /* Memory with Normal type, not shareable, outer/inner write back, write/read allocate */
+        MPU->RBAR = ARM_MPU_RBAR(BOARD_FRAME_BUFFER_MPU_REGION, regionBase);
+        MPU->RASR = ARM_MPU_RASR(0, ARM_MPU_AP_FULL, 1, 0, 1, 1, subRegionDisable, i - 1U);
+    }
+
+    __DSB();
+    __ISB();
+
+    EnableGlobalIRQ(primask);
+}
 #elif __CORTEX_M == 4
 void BOARD_ConfigMPU(void)
 {
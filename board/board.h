@@ -238,6 +238,29 @@ extern button_config_t g_buttonConfig[];
 #define BOARD_TM_INSTANCE   1
 #define BOARD_TM_CLOCK_ROOT kCLOCK_Root_Gpt1
 
+/* MPU region used for the frame buffer cache policy, it has the highest priority. */
+#define BOARD_FRAME_BUFFER_MPU_REGION 15U
+
+/* Internal, the smallest of 2^n ~ 2^(n+3) not less than size, otherwise larger. */
+#define BOARD_MPU_REGION_SIZE4(size, n, larger)                 \
+    (((size) <= (1UL << (n)))          ? (1UL << (n)) :          \
+     ((size) <= (1UL << ((n) + 1U)))   ? (1UL << ((n) + 1U)) :   \
+     ((size) <= (1UL << ((n) + 2U)))   ? (1UL << ((n) + 2U)) :   \
+     ((size) <= (1UL << ((n) + 3U)))   ? (1UL << ((n) + 3U)) :   \
+                                         (larger))
+
+/*
+ * Smallest MPU region (2^N bytes, 8 <= N <= 28, so it has sub-regions) not less than size.
+ * A frame buffer passed to BOARD_ConfigFrameBufferMPU should be aligned to it, and
+ * its size should be a multiple of the sub-region, which is 1/8 of the region.
+ */
+#define BOARD_FRAME_BUFFER_MPU_REGION_SIZE(size)                \
+    BOARD_MPU_REGION_SIZE4(size, 8U,                            \
+        BOARD_MPU_REGION_SIZE4(size, 12U,                       \
+            BOARD_MPU_REGION_SIZE4(size, 16U,                   \
+                BOARD_MPU_REGION_SIZE4(size, 20U,               \
+                    BOARD_MPU_REGION_SIZE4(size, 24U, (1UL << 28U))))))
+
 #if defined(__cplusplus)
 extern "C" {
 #endif /* __cplusplus */
@@ -250,6 +273,22 @@ uint32_t BOARD_DebugConsoleSrcFreq(void);
 void BOARD_InitDebugConsole(void);
 
 void BOARD_ConfigMPU(void);
+#if __CORTEX_M == 7
+/*!
+ * @brief Set the cache policy of the frame buffer memory.
+ *
+ * The smallest MPU region containing the buffer is used, only the sub-regions
+ * inside the buffer are enabled, so no other memory gets the policy. The buffer
+ * must fill whole sub-regions to be covered, see BOARD_FRAME_BUFFER_MPU_REGION_SIZE,
+ * this is asserted. The buffer should be placed in the cacheable memory. The
+ * whole D-cache is cleaned and invalidated before the policy changes.
+ *
+ * @param address Frame buffer start address, a multiple of the sub-region size.
+ * @param size Frame buffer size in bytes, a multiple of the sub-region size.
+ * @param writeThrough Use write through if true, otherwise use write back.
+ */
+void BOARD_ConfigFrameBufferMPU(uint32_t address, uint32_t size, bool writeThrough);
+#endif
 #if defined(SDK_I2C_BASED_COMPONENT_USED) && SDK_I2C_BASED_COMPONENT_USED
 void BOARD_LPI2C_Init(LPI2C_Type *base, uint32_t clkSrc_Hz);
 status_t BOARD_LPI2C_Send(LPI2C_Type *base,
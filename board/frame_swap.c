@@ -0,0 +1,105 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "frame_swap.h"
+#include "fsl_debug_console.h"
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+static void DEMO_FrameSwapCallback(void *param, void *switchOffBuffer);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/* Display controller callback, in the vertical blanking interrupt. */
+static void DEMO_FrameSwapCallback(void *param, void *switchOffBuffer)
+{
+    demo_frame_swap_t *swap = (demo_frame_swap_t *)param;
+
+    swap->framePending = false;
+
+    /* The switched off buffer could be drawn from now, report it before the waiting task runs. */
+    if (swap->switchOffCallback != NULL)
+    {
+        swap->switchOffCallback(swap->switchOffParam, switchOffBuffer);
+    }
+
+#if defined(SDK_OS_FREE_RTOS)
+    BaseType_t taskAwake = pdFALSE;
+
+    (void)xSemaphoreGiveFromISR(swap->switchOff, &taskAwake);
+    portYIELD_FROM_ISR(taskAwake);
+#else
+    swap->switchOff = true;
+#endif
+}
+
+status_t DEMO_FrameSwapInit(demo_frame_swap_t *swap,
+                            const dc_fb_t *dc,
+                            uint8_t layer,
+                            dc_fb_callback_t switchOffCallback,
+                            void *switchOffParam)
+{
+#if defined(SDK_OS_FREE_RTOS)
+    if (swap->switchOff == NULL)
+    {
+        swap->switchOff = xSemaphoreCreateBinary();
+        if (swap->switchOff == NULL)
+        {
+            return kStatus_Fail;
+        }
+    }
+#else
+    swap->switchOff = false;
+#endif
+
+    swap->dc                = dc;
+    swap->layer             = layer;
+    swap->switchOffCallback = switchOffCallback;
+    swap->switchOffParam    = switchOffParam;
+    swap->framePending      = false;
+
+    dc->ops->setCallback(dc, layer, DEMO_FrameSwapCallback, swap);
+
+    return kStatus_Success;
+}
+
+void DEMO_FrameSwapSubmit(demo_frame_swap_t *swap, void *frameBuffer)
+{
+    /* Set before the buffer is passed, the callback could come before the call returns. */
+    swap->framePending = true;
+
+    (void)swap->dc->ops->setFrameBuffer(swap->dc, swap->layer, frameBuffer);
+}
+
+void DEMO_FrameSwapWaitSwitchOff(demo_frame_swap_t *swap)
+{
+#if defined(SDK_OS_FREE_RTOS)
+    if (xSemaphoreTake(swap->switchOff, portMAX_DELAY) != pdTRUE)
+    {
+        PRINTF("Frame swap failed\r\n");
+        assert(0);
+    }
+#else
+    while (false == swap->switchOff)
+    {
+    }
+    swap->switchOff = false;
+#endif
+}
+
+void DEMO_FrameSwapWaitFrame(demo_frame_swap_t *swap)
+{
+    /* The switch off might be reported for an earlier frame, so check the flag again. */
+    while (swap->framePending)
+    {
+        DEMO_FrameSwapWaitSwitchOff(swap);
+    }
+}
@@ -0,0 +1,106 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _FRAME_SWAP_H_
+#define _FRAME_SWAP_H_
+
+#include "fsl_common.h"
+#include "fsl_dc_fb.h"
+#if defined(SDK_OS_FREE_RTOS)
+#include "FreeRTOS.h"
+#include "semphr.h"
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*!
+ * @brief Frame buffer swap of one display controller layer.
+ *
+ * A frame buffer passed to the display controller is shown from the next
+ * vertical blanking, the buffer shown before is switched off then and reported
+ * by the display controller callback. Until then the new buffer is pending and
+ * the old one must not be drawn.
+ *
+ * The members are internal. The handle must be zero initialized before the
+ * first @ref DEMO_FrameSwapInit.
+ */
+typedef struct _demo_frame_swap
+{
+    const dc_fb_t *dc;                  /*!< Display controller. */
+    uint8_t layer;                      /*!< Display controller layer. */
+    dc_fb_callback_t switchOffCallback; /*!< Called when a buffer is switched off, could be NULL. */
+    void *switchOffParam;               /*!< Parameter of switchOffCallback. */
+    /* Frame buffer is passed to display controller but not shown yet. */
+    volatile bool framePending;
+#if defined(SDK_OS_FREE_RTOS)
+    SemaphoreHandle_t switchOff;
+#else
+    volatile bool switchOff;
+#endif
+} demo_frame_swap_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * @brief Initialize the frame buffer swap and install the display controller callback.
+ *
+ * With FreeRTOS, the semaphore is created at the first call and kept later.
+ *
+ * @param swap The frame swap handle.
+ * @param dc Display controller.
+ * @param layer Display controller layer.
+ * @param switchOffCallback Called in the display controller callback when a
+ * buffer is switched off, before the waiting task is released. Could be NULL.
+ * @param switchOffParam Parameter of switchOffCallback.
+ * @retval kStatus_Success Initialized.
+ * @retval kStatus_Fail The semaphore could not be created.
+ */
+status_t DEMO_FrameSwapInit(demo_frame_swap_t *swap,
+                            const dc_fb_t *dc,
+                            uint8_t layer,
+                            dc_fb_callback_t switchOffCallback,
+                            void *switchOffParam);
+
+/*!
+ * @brief Pass a frame buffer to the display controller without waiting.
+ *
+ * The frame is pending until the display controller reports the buffer shown
+ * before is switched off.
+ *
+ * @param swap The frame swap handle.
+ * @param frameBuffer The frame buffer to show.
+ */
+void DEMO_FrameSwapSubmit(demo_frame_swap_t *swap, void *frameBuffer);
+
+/*!
+ * @brief Wait for one buffer switch off reported by the display controller.
+ *
+ * A switch off reported before the call, while nothing waits, returns at once.
+ *
+ * @param swap The frame swap handle.
+ */
+void DEMO_FrameSwapWaitSwitchOff(demo_frame_swap_t *swap);
+
+/*!
+ * @brief Wait until the pending frame, if any, is shown.
+ *
+ * @param swap The frame swap handle.
+ */
+void DEMO_FrameSwapWaitFrame(demo_frame_swap_t *swap);
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+#endif /* _FRAME_SWAP_H_ */
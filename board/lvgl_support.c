@@ -8,9 +8,12 @@
 #include "lvgl_support.h"
 #include "lvgl/lvgl.h"
 #include "lvgl/src/misc/lv_profiler_builtin_private.h"
+#include "lvgl/src/display/lv_display_private.h"
+#include "lvgl/src/misc/lv_timer_private.h"
 #if defined(SDK_OS_FREE_RTOS)
 #include "FreeRTOS.h"
 #include "semphr.h"
+#include "task.h"
 #endif
 #include "board.h"
 
@@ -19,18 +22,21 @@
 #include "fsl_gpio.h"
 
 #include "fsl_gt911.h"
+#include "rotate_support.h"
+#include "beam_race.h"
+#include "area_coalesce.h"
+#include "frame_swap.h"
+#include "pxp_support.h"
+#include "pxp_dispatch.h"
 
 #if 1 // LV_USE_GPU_NXP_VG_LITE
 #include "vg_lite.h"
 #include "vglite_support.h"
 #endif
 
-#if LV_USE_GPU_NXP_PXP
-#include "draw/nxp/pxp/lv_draw_pxp_blend.h"
-#endif
-
 #if (DEMO_DISPLAY_CONTROLLER == DEMO_DISPLAY_CONTROLLER_LCDIFV2)
 #include "fsl_lcdifv2.h"
+#include "fsl_dc_fb_lcdifv2.h"
 #else
 #include "fsl_elcdif.h"
 #endif
@@ -48,6 +54,30 @@
 #endif
 #endif
 
+/*
+ * Beam racing, only one frame buffer is used. LVGL renders horizontal bands in
+ * a small buffer, each band is copied to the frame buffer after the LCDIFV2
+ * scanout passed it, so the panel never shows a half written band.
+ */
+#ifndef DEMO_BEAM_RACE
+#define DEMO_BEAM_RACE 0
+#endif
+
+#if DEMO_BEAM_RACE && DEMO_USE_ROTATE
+#error "Beam racing doesn't support rotation"
+#endif
+
+#if DEMO_BEAM_RACE
+#define DEMO_FB_COUNT 1
+#else
+#define DEMO_FB_COUNT 2
+#endif
+
+/* Lines rendered by LVGL in one band. */
+#ifndef DEMO_BEAM_BAND_LINES
+#define DEMO_BEAM_BAND_LINES 80
+#endif
+
 /* Cache line size. */
 #ifndef FSL_FEATURE_L2CACHE_LINESIZE_BYTE
 #define FSL_FEATURE_L2CACHE_LINESIZE_BYTE 0
@@ -75,7 +105,247 @@
 
 #define DEMO_FB_SIZE \
     (((DEMO_BUFFER_WIDTH * DEMO_BUFFER_HEIGHT * LCD_FB_BYTE_PER_PIXEL) + DEMO_FB_ALIGN - 1) & ~(DEMO_FB_ALIGN - 1))
+
+/*
+ * Frame buffer cache policy. Software rendering reads back the frame buffer
+ * pixels, it is much faster with cacheable frame buffer. With write back, the
+ * areas written by CPU are cleaned before passed to the display controller.
+ */
+#define DEMO_FB_NONCACHEABLE  0
+#define DEMO_FB_WRITE_BACK    1
+#define DEMO_FB_WRITE_THROUGH 2
+
+#ifndef DEMO_FB_CACHE_MODE
+#define DEMO_FB_CACHE_MODE DEMO_FB_NONCACHEABLE
+#endif
+
+#if (DEMO_FB_CACHE_MODE == DEMO_FB_NONCACHEABLE)
 #define DEMO_FB_USE_NONCACHEABLE_SECTION
+#endif
+
+/* Only write back frame buffer needs cache clean before shown. */
+#if (DEMO_FB_CACHE_MODE == DEMO_FB_WRITE_BACK) && !defined(DISABLE_DISPLAY)
+#define DEMO_FB_NEED_CLEAN 1
+#else
+#define DEMO_FB_NEED_CLEAN 0
+#endif
+
+/*
+ * The cache policy is set by an MPU region, see BOARD_ConfigFrameBufferMPU. The
+ * frame buffers start at the region base and are padded to whole sub-regions,
+ * so the policy covers exactly the frame buffers.
+ */
+#if (DEMO_FB_CACHE_MODE != DEMO_FB_NONCACHEABLE) && (__CORTEX_M == 7)
+#define DEMO_FB_MPU_REGION_SIZE BOARD_FRAME_BUFFER_MPU_REGION_SIZE(DEMO_FB_COUNT * DEMO_FB_SIZE)
+#define DEMO_FB_STORAGE_SIZE SDK_SIZEALIGN(DEMO_FB_SIZE, DEMO_FB_MPU_REGION_SIZE / 8U / DEMO_FB_COUNT)
+#define DEMO_FB_STORAGE_ALIGN DEMO_FB_MPU_REGION_SIZE
+#else
+#define DEMO_FB_STORAGE_SIZE DEMO_FB_SIZE
+#define DEMO_FB_STORAGE_ALIGN DEMO_FB_ALIGN
+#endif
+
+/*
+ * Asynchronous flush: flush_cb only queues the frame buffer to the display
+ * controller and returns, the flush ready is reported to LVGL in the buffer
+ * switch off callback. LVGL could prepare the next frame while the current
+ * frame waits for the vertical blanking.
+ */
+#if defined(DISABLE_DISPLAY) || DEMO_USE_ROTATE || DEMO_BEAM_RACE
+#undef DEMO_FLUSH_ASYNC
+#define DEMO_FLUSH_ASYNC 0
+#endif
+
+#ifndef DEMO_FLUSH_ASYNC
+#define DEMO_FLUSH_ASYNC 1
+#endif
+
+/*
+ * In DIRECT mode the two frame buffers are used in turn, the areas flushed in
+ * last frame are copied from the shown buffer to the other one before LVGL
+ * renders the next frame, so only the dirty pixels are synchronized.
+ */
+#if defined(DISABLE_DISPLAY) || DEMO_USE_ROTATE || DEMO_BEAM_RACE
+#define DEMO_SYNC_DIRTY_AREA 0
+#else
+#define DEMO_SYNC_DIRTY_AREA 1
+#endif
+
+/* The flushed areas are tracked for buffer synchronization or rotation. */
+#if DEMO_SYNC_DIRTY_AREA || (DEMO_USE_ROTATE && !defined(DISABLE_DISPLAY))
+#define DEMO_TRACK_DIRTY_AREA 1
+#else
+#define DEMO_TRACK_DIRTY_AREA 0
+#endif
+
+/* Max dirty areas recorded per frame, whole frame is used if overflow. */
+#ifndef DEMO_DIRTY_AREA_MAX
+#define DEMO_DIRTY_AREA_MAX LV_INV_BUF_SIZE
+#endif
+
+/*
+ * The PXP is shared with the LVGL PXP draw unit, see DEMO_PXP_SHARE_LVGL. LVGL
+ * renders with the PXP locked, the PXP jobs of the port wait meanwhile.
+ */
+#if LV_USE_PXP && DEMO_PXP_SHARE_LVGL
+#define DEMO_PXP_LOCK_RENDER 1
+#else
+#define DEMO_PXP_LOCK_RENDER 0
+#endif
+
+/*
+ * Synchronize the dirty areas with PXP in background. Only the parts not rendered
+ * again in this frame are copied, so LVGL renders while PXP copies. The frame
+ * buffers must be non-cacheable, otherwise the cache lines shared by the CPU
+ * rendered pixels and the PXP copied pixels get corrupted. Not used when LVGL
+ * owns the PXP without sharing it.
+ */
+#if !DEMO_SYNC_DIRTY_AREA || (DEMO_FB_CACHE_MODE != DEMO_FB_NONCACHEABLE) || (LV_USE_PXP && !DEMO_PXP_LOCK_RENDER) \
+    || LV_USE_GPU_NXP_PXP
+#undef DEMO_PXP_SYNC
+#define DEMO_PXP_SYNC 0
+#endif
+
+#ifndef DEMO_PXP_SYNC
+#define DEMO_PXP_SYNC 1
+#endif
+
+/*
+ * Rotate the dirty areas with PXP instead of CPU. The flush waits for the PXP
+ * completion interrupt, the CPU is free for other tasks meanwhile. PXP writes
+ * the frame buffers, so they must be non-cacheable. Not used when LVGL owns the
+ * PXP without sharing it.
+ */
+#if !DEMO_USE_ROTATE || defined(DISABLE_DISPLAY) || (DEMO_FB_CACHE_MODE != DEMO_FB_NONCACHEABLE) \
+    || (LV_USE_PXP && !DEMO_PXP_LOCK_RENDER) || LV_USE_GPU_NXP_PXP
+#undef DEMO_PXP_ROTATE
+#define DEMO_PXP_ROTATE 0
+#endif
+
+#ifndef DEMO_PXP_ROTATE
+#define DEMO_PXP_ROTATE 1
+#endif
+
+/*
+ * Choose CPU or PXP for every copy and rotation by its size. The crossover sizes
+ * are measured at initialization and printed as a table, define
+ * DEMO_PXP_CALIB_TABLE as the printed table to load it instead of measuring.
+ */
+#if !DEMO_PXP_SYNC && !DEMO_PXP_ROTATE
+#undef DEMO_PXP_DISPATCH
+#define DEMO_PXP_DISPATCH 0
+#endif
+
+#ifndef DEMO_PXP_DISPATCH
+#define DEMO_PXP_DISPATCH 1
+#endif
+
+/* The calibration table is only valid with the same core clock and frame buffer cache mode. */
+#define DEMO_PXP_CALIB_CONFIG (((SystemCoreClock / 1000000U) << 8U) | (uint32_t)DEMO_FB_CACHE_MODE)
+
+/*
+ * Merge the flushed areas when their bounding area costs less than the separate
+ * areas. The cost of an area is a fixed cost plus a per pixel cost of every
+ * stage processing it (buffer synchronization, rotation, cache clean), the cost
+ * parameters are measured at initialization.
+ */
+#if !DEMO_TRACK_DIRTY_AREA
+#undef DEMO_COALESCE_AREA
+#define DEMO_COALESCE_AREA 0
+#endif
+
+#ifndef DEMO_COALESCE_AREA
+#define DEMO_COALESCE_AREA 1
+#endif
+
+/* Every measurement is repeated, the shortest is used to filter out the interrupts. */
+#define DEMO_AREA_COST_REPEAT 4U
+
+/*
+ * Pace the rendering with the LCDIFV2 vertical blanking. The LVGL task is woken
+ * at the render slot, which is DEMO_RENDER_AHEAD_US before a vertical blanking,
+ * the LVGL timers still run at their own deadlines between the render slots.
+ */
+#if defined(DISABLE_DISPLAY) || (DEMO_DISPLAY_CONTROLLER != DEMO_DISPLAY_CONTROLLER_LCDIFV2) \
+    || !defined(SDK_OS_FREE_RTOS)
+#undef DEMO_VSYNC_SCHEDULE
+#define DEMO_VSYNC_SCHEDULE 0
+#endif
+
+#ifndef DEMO_VSYNC_SCHEDULE
+#define DEMO_VSYNC_SCHEDULE 1
+#endif
+
+/* How long the rendering starts before the vertical blanking, in microsecond. */
+#ifndef DEMO_RENDER_AHEAD_US
+#define DEMO_RENDER_AHEAD_US 0
+#endif
+
+/* Period to print the frame to vertical blanking phase statistics, 0 to disable. */
+#ifndef DEMO_SCHED_STAT_PERIOD_MS
+#define DEMO_SCHED_STAT_PERIOD_MS 5000
+#endif
+
+/* LVGL refresh timer period, it only takes effect when the vertical blanking stops. */
+#define DEMO_SCHED_FALLBACK_PERIOD_MS (LV_DEF_REFR_PERIOD * 2)
+
+/* Longest wait when there is no LVGL timer ready. */
+#define DEMO_SCHED_MAX_IDLE_MS 1000U
+
+/* The scanout position is estimated from the vertical blanking timing. */
+#if DEMO_BEAM_RACE && !DEMO_VSYNC_SCHEDULE && !defined(DISABLE_DISPLAY)
+#error "Beam racing needs the vertical blanking timing of DEMO_VSYNC_SCHEDULE"
+#endif
+
+/* LCDIFV2 hardware layers could be used as extra LVGL displays, see lv_port_plane_create. */
+#if (DEMO_DISPLAY_CONTROLLER == DEMO_DISPLAY_CONTROLLER_LCDIFV2) && !defined(DISABLE_DISPLAY)
+#define DEMO_USE_PLANE 1
+#else
+#define DEMO_USE_PLANE 0
+#endif
+
+/*
+ * Record the time of every frame phase in a ring, see lv_port_timing_get. The
+ * phases are stamped with the DWT cycle counter, a few cycles per phase switch.
+ */
+#if defined(DISABLE_DISPLAY)
+#undef DEMO_FRAME_TIMING
+#define DEMO_FRAME_TIMING 0
+#endif
+
+#ifndef DEMO_FRAME_TIMING
+#define DEMO_FRAME_TIMING 0
+#endif
+
+/* Frames kept in the timing ring. */
+#ifndef DEMO_FRAME_TIMING_COUNT
+#define DEMO_FRAME_TIMING_COUNT 64U
+#endif
+
+/* Period to print the frame timing, 0 to disable. */
+#ifndef DEMO_FRAME_TIMING_DUMP_PERIOD_MS
+#define DEMO_FRAME_TIMING_DUMP_PERIOD_MS 5000
+#endif
+
+/*
+ * Compare the write back and write through frame buffer with the same build:
+ * the cache policy is switched after every timing dump, and the dump is labeled
+ * with the policy and the frame rate of the period. The frame buffer is built
+ * write back, its cache clean is harmless with write through.
+ */
+#ifndef DEMO_FB_CACHE_COMPARE
+#define DEMO_FB_CACHE_COMPARE 0
+#endif
+
+#if DEMO_FB_CACHE_COMPARE && ((DEMO_FB_CACHE_MODE != DEMO_FB_WRITE_BACK) || (__CORTEX_M != 7) \
+    || !DEMO_FRAME_TIMING || !DEMO_FRAME_TIMING_DUMP_PERIOD_MS)
+#error "DEMO_FB_CACHE_COMPARE needs write back frame buffer on CM7 and the frame timing dump"
+#endif
+
+/* Time not in any frame phase, such as idle between the frames. */
+#define DEMO_TIMING_IDLE LV_PORT_TIMING_PHASE_COUNT
+
+/* The phase is not measured for the frame. */
+#define DEMO_TIMING_INVALID UINT32_MAX
 
 #if DEMO_USE_ROTATE
 #define LVGL_BUFFER_WIDTH DEMO_BUFFER_HEIGHT
@@ -85,6 +355,58 @@
 #define LVGL_BUFFER_HEIGHT DEMO_BUFFER_HEIGHT
 #endif
 
+#if DEMO_TRACK_DIRTY_AREA
+/* Dirty areas in LVGL coordinate, full frame is one area when overflow. */
+typedef struct _demo_dirty_list {
+    lv_area_t areas[DEMO_DIRTY_AREA_MAX];
+    uint32_t count;
+    bool fullFrame;
+} demo_dirty_list_t;
+#endif
+
+#if DEMO_VSYNC_SCHEDULE
+/* Frame to vertical blanking phase statistics, in CPU cycles. */
+typedef struct _demo_sched_stat {
+    uint32_t frames; /* Frames shown. */
+    uint32_t lateFrames; /* Frames rendered in a slot but not ready at the target vertical blanking. */
+    uint32_t skippedVsyncs; /* Vertical blankings without new frame. */
+    uint32_t minPhase;
+    uint32_t maxPhase;
+    uint64_t sumPhase;
+} demo_sched_stat_t;
+#endif
+
+#if DEMO_COALESCE_AREA
+/* Stages processing the flushed areas. */
+typedef enum _demo_area_stage {
+    kDEMO_AreaStageCpuCopy = 0, /* Buffer synchronization by CPU. */
+    kDEMO_AreaStagePxpCopy, /* Buffer synchronization by PXP. */
+    kDEMO_AreaStageRotate, /* Rotation by CPU. */
+    kDEMO_AreaStageCacheClean, /* Frame buffer cache clean. */
+    kDEMO_AreaStageCount,
+} demo_area_stage_t;
+#endif
+
+#if DEMO_FRAME_TIMING
+/* Time of each phase in one frame, in CPU cycles. */
+typedef struct _demo_frame_timing {
+    uint32_t cycles[LV_PORT_TIMING_PHASE_COUNT];
+} demo_frame_timing_t;
+#endif
+
+#if DEMO_USE_PLANE
+/* LVGL display shown in a LCDIFV2 hardware layer. */
+typedef struct _demo_plane {
+    lv_display_t* disp;
+    uint8_t layer;
+    bool enabled;
+    lv_color_format_t colorFormat;
+    lv_draw_buf_t* drawBuf[2];
+    lcdifv2_blend_config_t blend;
+    demo_frame_swap_t swap;
+} demo_plane_t;
+#endif
+
 /*******************************************************************************
  * Prototypes
  ******************************************************************************/
@@ -99,6 +421,116 @@ static void BOARD_ConfigMIPIPanelTouchIntPin(gt911_int_pin_mode_t mode);
 
 static void DEMO_WaitBufferSwitchOff(void);
 
+#if DEMO_FB_NEED_CLEAN || DEMO_PXP_ROTATE
+static void DEMO_CleanFrameBufferRect(
+    const void* buf, uint32_t stride, int32_t x, int32_t y, int32_t width, int32_t height);
+#endif
+
+#if DEMO_FLUSH_ASYNC
+static void DEMO_WaitFlushDisplay(lv_display_t* disp);
+#endif
+
+#if DEMO_PXP_LOCK_RENDER
+static void DEMO_PXPLockEventCallback(lv_event_t* e);
+
+static void DEMO_PXPLockFlushCallback(lv_display_t* disp, const lv_area_t* area, uint8_t* color_p);
+#endif
+
+#if DEMO_TRACK_DIRTY_AREA
+static void DEMO_AddDirtyArea(demo_dirty_list_t* list, const lv_area_t* area);
+
+static void DEMO_ClearDirtyArea(demo_dirty_list_t* list);
+#endif
+
+static void DEMO_FrameEventCallback(lv_event_t* e);
+
+#if DEMO_SYNC_DIRTY_AREA
+static void DEMO_CopyArea(uint8_t* dest, const uint8_t* src, uint32_t stride, const lv_area_t* area);
+
+static void DEMO_DisplayEventCallback(lv_event_t* e);
+#endif
+
+#if DEMO_COALESCE_AREA
+static bool DEMO_IsAreaStageUsed(demo_area_stage_t stage);
+
+static uint32_t DEMO_MeasureAreaCost(demo_area_stage_t stage, int32_t width, int32_t height);
+
+static void DEMO_CalibrateAreaCost(void);
+
+static void DEMO_CoalesceDirtyArea(demo_dirty_list_t* list);
+#endif
+
+#if DEMO_PXP_SYNC
+static bool DEMO_AddCopyRects(lv_display_t* disp, const lv_area_t* area);
+
+static void DEMO_WaitCopyRects(void);
+#endif
+
+#if DEMO_PXP_ROTATE
+static void DEMO_RotateAreas(void* frameBuffer, const uint8_t* lvglBuffer, const lv_area_t* areas, uint32_t count);
+#endif
+
+#if DEMO_VSYNC_SCHEDULE
+static void DEMO_VsyncCallback(void* param);
+
+static uint32_t DEMO_GetRenderAhead(uint32_t period);
+
+static uint32_t DEMO_GetRenderSlot(uint32_t now);
+
+static void DEMO_StartRenderSlot(uint32_t slot);
+
+static bool DEMO_IsRefreshPending(void);
+
+static void DEMO_MarkFrameReady(void);
+
+#if DEMO_SCHED_STAT_PERIOD_MS
+static void DEMO_SchedStatTimerCallback(lv_timer_t* timer);
+#endif
+#endif
+
+#if DEMO_BEAM_RACE && !defined(DISABLE_DISPLAY)
+static void DEMO_WaitBeamPassed(int32_t y1, int32_t y2);
+
+static void DEMO_CopyBand(lv_display_t* disp, const lv_area_t* area, const uint8_t* color_p);
+#endif
+
+static bool DEMO_IsFormatSupported(lv_color_format_t cf);
+
+#if DEMO_BEAM_RACE && !defined(DISABLE_DISPLAY)
+static void DEMO_ConvertLine(
+    uint8_t* dest, lv_color_format_t destFormat, const uint8_t* src, lv_color_format_t srcFormat, uint32_t width);
+#endif
+
+#ifndef DISABLE_DISPLAY
+static void DEMO_ConfigFrameBufferLayer(video_pixel_format_t pixelFormat, uint32_t strideBytes);
+#endif
+
+#if DEMO_FRAME_TIMING
+static uint32_t DEMO_TimingSwitch(uint32_t phase);
+
+static void DEMO_TimingEventCallback(lv_event_t* e);
+
+static void DEMO_TimingSubmitFrame(void);
+
+static void DEMO_TimingFlipFrame(void);
+
+static void DEMO_TimingEndFrame(void);
+
+#if DEMO_FRAME_TIMING_DUMP_PERIOD_MS
+static void DEMO_TimingDumpTimerCallback(lv_timer_t* timer);
+#endif
+#endif
+
+#if DEMO_USE_PLANE
+static void DEMO_PlaneSwitchOffCallback(void* param, void* switchOffBuffer);
+
+static void DEMO_PlaneWaitFlush(lv_display_t* disp);
+
+static void DEMO_PlaneEventCallback(lv_event_t* e);
+
+static void DEMO_PlaneFlushCallback(lv_display_t* disp, const lv_area_t* area, uint8_t* px_map);
+#endif
+
 #if ((LV_COLOR_DEPTH == 8) || (LV_COLOR_DEPTH == 1))
 /*
  * To support 8 color depth and 1 color depth with this board, color palette is
@@ -111,9 +543,14 @@ static void DEMO_SetLcdColorPalette(void);
  * Variables
  ******************************************************************************/
 #ifdef DEMO_FB_USE_NONCACHEABLE_SECTION
-AT_NONCACHEABLE_SECTION_ALIGN(static uint8_t s_frameBuffer[2][DEMO_FB_SIZE], DEMO_FB_ALIGN);
+AT_NONCACHEABLE_SECTION_ALIGN(static uint8_t s_frameBuffer[DEMO_FB_COUNT][DEMO_FB_SIZE], DEMO_FB_ALIGN);
 #else
-SDK_ALIGN(static uint8_t s_frameBuffer[2][DEMO_FB_SIZE], DEMO_FB_ALIGN);
+SDK_ALIGN(static uint8_t s_frameBuffer[DEMO_FB_COUNT][DEMO_FB_STORAGE_SIZE], DEMO_FB_STORAGE_ALIGN);
+#endif
+
+#if DEMO_BEAM_RACE
+SDK_ALIGN(static uint8_t s_bandBuffer[DEMO_BEAM_BAND_LINES * LVGL_BUFFER_WIDTH * DEMO_BUFFER_BYTE_PER_PIXEL],
+    DEMO_FB_ALIGN);
 #endif
 
 #if DEMO_USE_ROTATE
@@ -130,10 +567,45 @@ SDK_ALIGN(static uint8_t s_lvglBuffer[1][DEMO_FB_SIZE], DEMO_FB_ALIGN);
 #endif
 #endif
 
-#if defined(SDK_OS_FREE_RTOS)
-static SemaphoreHandle_t s_transferDone;
-#else
-static volatile bool s_transferDone;
+/* Frame buffer swap of the main display layer. */
+static demo_frame_swap_t s_frameSwap;
+
+#if DEMO_TRACK_DIRTY_AREA
+/* Areas flushed in the frame. */
+static demo_dirty_list_t s_frameDirty;
+#endif
+
+/* Refreshes with nothing flushed, LVGL passes no frame to the port for them. */
+static uint32_t s_skippedFrames;
+static bool s_frameFlushed;
+
+#if DEMO_SYNC_DIRTY_AREA
+/* The frame buffer s_frameDirty is flushed from. */
+static const uint8_t* s_dirtyBuffer;
+#endif
+
+#if DEMO_PXP_SYNC
+/* The rectangles copied by PXP in this frame. */
+static demo_pxp_rect_t s_copyRects[DEMO_PXP_COPY_RECT_MAX];
+static uint32_t s_copyRectCount;
+/* Work lists to split a dirty area. */
+static lv_area_t s_copyParts[2][DEMO_PXP_COPY_RECT_MAX];
+#endif
+
+#if DEMO_PXP_ROTATE
+/* The rectangles rotated by PXP in one job. */
+static demo_pxp_rotate_rect_t s_rotateRects[DEMO_PXP_COPY_RECT_MAX];
+#endif
+
+#if DEMO_PXP_DISPATCH && defined(DEMO_PXP_CALIB_TABLE)
+/* Calibration table printed by an earlier run. */
+static const demo_pxp_calib_t s_pxpCalib = DEMO_PXP_CALIB_TABLE;
+#endif
+
+#if DEMO_COALESCE_AREA
+/* Cost of each stage, and the sum of the stages used. */
+static demo_area_cost_t s_areaStageCost[kDEMO_AreaStageCount];
+static demo_area_cost_t s_areaCost;
 #endif
 
 #if DEMO_USE_ROTATE
@@ -142,6 +614,69 @@ static volatile bool s_transferDone;
  * driver uses two buffers (s_frameBuffer) to remove tearing effect.
  */
 static void* volatile s_inactiveFrameBuffer;
+
+#if DEMO_TRACK_DIRTY_AREA
+/*
+ * Areas not rotated to each frame buffer yet. When one frame buffer is updated,
+ * the frame dirty areas are still missing in the other one.
+ */
+static demo_dirty_list_t s_bufferDirty[2];
+#endif
+#endif
+
+#if DEMO_VSYNC_SCHEDULE
+static lv_display_t* s_schedDisplay;
+static TaskHandle_t s_schedTask;
+/* CPU cycle count at the last vertical blanking, and the vertical blanking period. */
+static volatile uint32_t s_vsyncCycle;
+static volatile uint32_t s_vsyncPeriod;
+/* The last render slot, and the vertical blanking the frame rendered in it should catch. */
+static uint32_t s_renderSlot;
+static uint32_t s_targetCycle;
+static bool s_targetValid;
+/* CPU cycle count when the last frame is passed to display controller. */
+static volatile uint32_t s_frameReadyCycle;
+static volatile bool s_frameReady;
+/* The LVGL task waits for the vertical blanking notification. */
+static volatile bool s_vsyncWait;
+static demo_sched_stat_t s_schedStat;
+#endif
+
+#if DEMO_FRAME_TIMING
+/*
+ * Ring of the recent frames. A record is only written by the LVGL task, except
+ * the flip time written by the display ISR, and it is published by increasing
+ * s_timingHead, which is the number of frames recorded.
+ */
+static demo_frame_timing_t s_timing[DEMO_FRAME_TIMING_COUNT];
+static volatile uint32_t s_timingHead;
+
+/* Phase time of the frame in progress, the last entry collects the idle time. */
+static uint32_t s_timingAcc[LV_PORT_TIMING_PHASE_COUNT + 1];
+static uint32_t s_timingPhase = DEMO_TIMING_IDLE;
+static uint32_t s_timingStamp;
+
+/* The frame passed to display controller and not shown yet. */
+static volatile bool s_timingFlipPending;
+static uint32_t s_timingFlipSlot;
+static uint32_t s_timingFlipCycle;
+#endif
+
+/* The main display. */
+static lv_display_t* s_display;
+
+/*
+ * Runtime render format, and the format of frame buffers (scanout format), see
+ * lv_port_disp_set_format. The frame buffers are sized by DEMO_BUFFER_BYTE_PER_PIXEL.
+ */
+static lv_color_format_t s_renderFormat = DEMO_USE_XRGB8888 ? LV_COLOR_FORMAT_XRGB8888 : LV_COLOR_FORMAT_RGB565;
+static lv_color_format_t s_scanoutFormat = DEMO_USE_XRGB8888 ? LV_COLOR_FORMAT_XRGB8888 : LV_COLOR_FORMAT_RGB565;
+static uint8_t s_fbBytePerPixel = DEMO_BUFFER_BYTE_PER_PIXEL;
+static uint32_t s_fbStrideBytes = DEMO_BUFFER_STRIDE_BYTE;
+
+#if DEMO_USE_PLANE
+/* Indexed by the LCDIFV2 layer, layer 0 is used by the main display. */
+static demo_plane_t s_planes[DC_FB_LCDIFV2_MAX_LAYER];
 #endif
 
 static gt911_handle_t s_touchHandle;
@@ -211,17 +746,75 @@ void lv_port_pre_init(void)
 {
 }
 
+static bool DEMO_IsFormatSupported(lv_color_format_t cf)
+{
+    return (cf == LV_COLOR_FORMAT_RGB565) || (cf == LV_COLOR_FORMAT_XRGB8888);
+}
+
+#if DEMO_BEAM_RACE && !defined(DISABLE_DISPLAY)
+/* Copy one line of pixels, the color format is converted if different. */
+static void DEMO_ConvertLine(
+    uint8_t* dest, lv_color_format_t destFormat, const uint8_t* src, lv_color_format_t srcFormat, uint32_t width)
+{
+    if (destFormat == srcFormat) {
+        lv_memcpy(dest, src, width * lv_color_format_get_size(srcFormat));
+    } else if (destFormat == LV_COLOR_FORMAT_RGB565) {
+        const uint32_t* srcPixel = (const uint32_t*)src;
+        uint16_t* destPixel = (uint16_t*)dest;
+
+        for (uint32_t i = 0; i < width; i++) {
+            uint32_t pixel = srcPixel[i];
+
+            destPixel[i] = (uint16_t)(((pixel >> 8) & 0xF800U) | ((pixel >> 5) & 0x07E0U) | ((pixel >> 3) & 0x001FU));
+        }
+    } else {
+        const uint16_t* srcPixel = (const uint16_t*)src;
+        uint32_t* destPixel = (uint32_t*)dest;
+
+        for (uint32_t i = 0; i < width; i++) {
+            uint32_t pixel = srcPixel[i];
+            uint32_t r = (pixel >> 11) & 0x1FU;
+            uint32_t g = (pixel >> 5) & 0x3FU;
+            uint32_t b = pixel & 0x1FU;
+
+            /* Replicate the high bits to the low bits, so white is still white. */
+            destPixel[i] = 0xFF000000U | (((r << 3) | (r >> 2)) << 16) | (((g << 2) | (g >> 4)) << 8)
+                | ((b << 3) | (b >> 2));
+        }
+    }
+}
+#endif /* DEMO_BEAM_RACE */
+
 #ifndef DISABLE_DISPLAY
 
+/* The new configuration is loaded together with the next frame buffer. */
+static void DEMO_ConfigFrameBufferLayer(video_pixel_format_t pixelFormat, uint32_t strideBytes)
+{
+    dc_fb_info_t fbInfo;
+
+    g_dc.ops->getLayerDefaultConfig(&g_dc, 0, &fbInfo);
+    fbInfo.pixelFormat = pixelFormat;
+    fbInfo.width = DEMO_BUFFER_WIDTH;
+    fbInfo.height = DEMO_BUFFER_HEIGHT;
+    fbInfo.startX = DEMO_BUFFER_START_X;
+    fbInfo.startY = DEMO_BUFFER_START_Y;
+    fbInfo.strideBytes = strideBytes;
+    g_dc.ops->setLayerConfig(&g_dc, 0, &fbInfo);
+}
+
 static void DEMO_BufferSwitchOffCallback(void* param, void* switchOffBuffer)
 {
-#if defined(SDK_OS_FREE_RTOS)
-    BaseType_t taskAwake = pdFALSE;
+#if DEMO_FRAME_TIMING
+    DEMO_TimingFlipFrame();
+#endif
 
-    xSemaphoreGiveFromISR(s_transferDone, &taskAwake);
-    portYIELD_FROM_ISR(taskAwake);
+#if DEMO_FLUSH_ASYNC
+    /* param is the LVGL display, the shown buffer could be used by LVGL now. */
+    if (param != NULL) {
+        lv_display_flush_ready((lv_display_t*)param);
+    }
 #else
-    s_transferDone = true;
+    LV_UNUSED(param);
 #endif
 
 #if DEMO_USE_ROTATE
@@ -231,35 +824,950 @@ static void DEMO_BufferSwitchOffCallback(void* param, void* switchOffBuffer)
 
 static void DEMO_WaitBufferSwitchOff(void)
 {
-#if defined(SDK_OS_FREE_RTOS)
-    if (xSemaphoreTake(s_transferDone, portMAX_DELAY) != pdTRUE) {
-        PRINTF("Display flush failed\r\n");
-        assert(0);
-    }
-#else
-    while (false == s_transferDone) {
-    }
-    s_transferDone = false;
+#if DEMO_FRAME_TIMING
+    uint32_t timingPhase = DEMO_TimingSwitch(LV_PORT_TIMING_WAIT);
+#endif
+
+    DEMO_FrameSwapWaitSwitchOff(&s_frameSwap);
+
+#if DEMO_FRAME_TIMING
+    (void)DEMO_TimingSwitch(timingPhase);
 #endif
 }
 
-static void DEMO_FlushDisplay(lv_display_t* disp, const lv_area_t* area, uint8_t* color_p)
+#if DEMO_FLUSH_ASYNC
+/* Called by LVGL before it touches the frame buffer which is flushed last time. */
+static void DEMO_WaitFlushDisplay(lv_display_t* disp)
 {
-#if DEMO_USE_ROTATE
+    LV_UNUSED(disp);
 
-    /*
-     * Work flow:
-     *
-     * 1. Wait for the available inactive frame buffer to draw.
-     * 2. Draw the ratated frame to inactive buffer.
-     * 3. Pass inactive to LCD controller to show.
-     */
+#if DEMO_FRAME_TIMING
+    uint32_t timingPhase = DEMO_TimingSwitch(LV_PORT_TIMING_WAIT);
+#endif
 
-    static bool firstFlush = true;
+    DEMO_FrameSwapWaitFrame(&s_frameSwap);
 
-    /* Only wait for the first time. */
-    if (firstFlush) {
-        firstFlush = false;
+#if DEMO_FRAME_TIMING
+    (void)DEMO_TimingSwitch(timingPhase);
+#endif
+}
+#endif
+
+#if DEMO_FB_NEED_CLEAN || DEMO_PXP_ROTATE
+/* Clean the buffer rectangle written by CPU before display controller or PXP reads it. */
+static void DEMO_CleanFrameBufferRect(
+    const void* buf, uint32_t stride, int32_t x, int32_t y, int32_t width, int32_t height)
+{
+    uint32_t addr = (uint32_t)buf + (uint32_t)y * stride + (uint32_t)x * s_fbBytePerPixel;
+#if DEMO_FRAME_TIMING
+    uint32_t timingPhase = DEMO_TimingSwitch(LV_PORT_TIMING_CACHE);
+#endif
+
+#if __CORTEX_M == 4
+    for (int32_t i = 0; i < height; i++) {
+        L1CACHE_CleanInvalidateSystemCacheByRange(addr, (uint32_t)width * s_fbBytePerPixel);
+        addr += stride;
+    }
+#else
+    DCACHE_CleanByRect(addr, stride, (uint32_t)width * s_fbBytePerPixel, (uint32_t)height);
+#endif
+
+#if DEMO_FRAME_TIMING
+    (void)DEMO_TimingSwitch(timingPhase);
+#endif
+}
+#endif
+
+#if DEMO_TRACK_DIRTY_AREA
+static void DEMO_AddDirtyArea(demo_dirty_list_t* list, const lv_area_t* area)
+{
+    /* Nothing drawn in empty area. */
+    if (list->fullFrame || (area->x2 < area->x1) || (area->y2 < area->y1)) {
+        return;
+    }
+
+    for (uint32_t i = 0; i < list->count; i++) {
+        if (lv_area_is_in(area, &list->areas[i], 0)) {
+            return;
+        }
+
+        if (lv_area_is_in(&list->areas[i], area, 0)) {
+            list->areas[i] = *area;
+            return;
+        }
+    }
+
+    if (list->count < DEMO_DIRTY_AREA_MAX) {
+        list->areas[list->count++] = *area;
+    } else {
+        /* Too many areas, use the whole frame. */
+        lv_area_set(&list->areas[0], 0, 0, LVGL_BUFFER_WIDTH - 1, LVGL_BUFFER_HEIGHT - 1);
+        list->count = 1;
+        list->fullFrame = true;
+    }
+}
+
+static void DEMO_ClearDirtyArea(demo_dirty_list_t* list)
+{
+    list->count = 0;
+    list->fullFrame = false;
+}
+
+#if DEMO_COALESCE_AREA
+static bool DEMO_IsAreaStageUsed(demo_area_stage_t stage)
+{
+    switch (stage) {
+#if DEMO_SYNC_DIRTY_AREA && !DEMO_PXP_SYNC
+    case kDEMO_AreaStageCpuCopy:
+        return true;
+#endif
+
+#if DEMO_PXP_SYNC
+    case kDEMO_AreaStagePxpCopy:
+        return true;
+#endif
+
+#if DEMO_USE_ROTATE
+    case kDEMO_AreaStageRotate:
+        return true;
+#endif
+
+#if DEMO_FB_NEED_CLEAN
+    case kDEMO_AreaStageCacheClean:
+        return true;
+#endif
+
+    default:
+        return false;
+    }
+}
+
+/* Process an area at the top left of the frame buffers, return the CPU cycles used. */
+static uint32_t DEMO_MeasureAreaCost(demo_area_stage_t stage, int32_t width, int32_t height)
+{
+    uint32_t best = UINT32_MAX;
+    uint32_t start;
+    lv_area_t area;
+
+    lv_area_set(&area, 0, 0, width - 1, height - 1);
+
+    for (uint32_t i = 0; i < DEMO_AREA_COST_REPEAT; i++) {
+#if DEMO_FB_NEED_CLEAN
+        if (stage == kDEMO_AreaStageCacheClean) {
+            /* Make the cache lines dirty as CPU rendering does. */
+            for (int32_t y = 0; y < height; y++) {
+                lv_memset(s_frameBuffer[0] + (uint32_t)y * s_fbStrideBytes, 0, (uint32_t)width * s_fbBytePerPixel);
+            }
+        }
+#endif
+
+        start = MSDK_GetCpuCycleCount();
+
+        switch (stage) {
+#if DEMO_SYNC_DIRTY_AREA
+        case kDEMO_AreaStageCpuCopy:
+            DEMO_CopyArea(s_frameBuffer[1], s_frameBuffer[0], s_fbStrideBytes, &area);
+            break;
+#endif
+
+#if DEMO_PXP_SYNC
+        case kDEMO_AreaStagePxpCopy: {
+            const demo_pxp_rect_t rect = {
+                .x = 0U,
+                .y = 0U,
+                .width = (uint16_t)width,
+                .height = (uint16_t)height,
+            };
+
+            (void)DEMO_PXP_StartCopyRects(
+                s_frameBuffer[1], s_frameBuffer[0], s_fbStrideBytes, s_fbBytePerPixel, &rect, 1U);
+            DEMO_PXP_WaitCopy();
+            break;
+        }
+#endif
+
+#if DEMO_PXP_ROTATE
+        case kDEMO_AreaStageRotate:
+            DEMO_RotateAreas(s_frameBuffer[0], s_lvglBuffer[0], &area, 1U);
+            break;
+#elif DEMO_USE_ROTATE
+        case kDEMO_AreaStageRotate: {
+            const demo_rotate_image_t srcImage = {
+                .buffer = s_lvglBuffer[0],
+                .strideBytes = LVGL_BUFFER_WIDTH * DEMO_BUFFER_BYTE_PER_PIXEL,
+                .width = LVGL_BUFFER_WIDTH,
+                .height = LVGL_BUFFER_HEIGHT,
+                .bytePerPixel = DEMO_BUFFER_BYTE_PER_PIXEL,
+            };
+            const demo_rotate_image_t destImage = {
+                .buffer = s_frameBuffer[0],
+                .strideBytes = DEMO_BUFFER_STRIDE_BYTE,
+                .width = DEMO_BUFFER_WIDTH,
+                .height = DEMO_BUFFER_HEIGHT,
+                .bytePerPixel = DEMO_BUFFER_BYTE_PER_PIXEL,
+            };
+            const demo_rotate_rect_t rect = {
+                .x = 0U,
+                .y = 0U,
+                .width = (uint16_t)width,
+                .height = (uint16_t)height,
+            };
+
+            DEMO_RotateRect(&destImage, &srcImage, &rect, kDEMO_Rotate270);
+            break;
+        }
+#endif
+
+#if DEMO_FB_NEED_CLEAN
+        case kDEMO_AreaStageCacheClean:
+            DEMO_CleanFrameBufferRect(s_frameBuffer[0], s_fbStrideBytes, 0, 0, width, height);
+            break;
+#endif
+
+        default:
+            break;
+        }
+
+        best = LV_MIN(best, MSDK_GetCpuCycleCount() - start);
+    }
+
+    return best;
+}
+
+/*
+ * Measure a small area and a large area for every stage used, the fixed cost
+ * and the pixel cost are the line through the two points. It must be called
+ * before the frame buffers are shown.
+ */
+static void DEMO_CalibrateAreaCost(void)
+{
+    const int32_t smallSize = 8;
+    const int32_t largeWidth = 128;
+    const int32_t largeHeight = 64;
+    const uint32_t smallPixels = (uint32_t)(smallSize * smallSize);
+    const uint32_t largePixels = (uint32_t)(largeWidth * largeHeight);
+
+    lv_memzero(&s_areaCost, sizeof(s_areaCost));
+
+    for (uint32_t i = 0; i < (uint32_t)kDEMO_AreaStageCount; i++) {
+        demo_area_cost_t* cost = &s_areaStageCost[i];
+        uint32_t smallCycles;
+        uint32_t largeCycles;
+
+        if (!DEMO_IsAreaStageUsed((demo_area_stage_t)i)) {
+            continue;
+        }
+
+        smallCycles = DEMO_MeasureAreaCost((demo_area_stage_t)i, smallSize, smallSize);
+        largeCycles = DEMO_MeasureAreaCost((demo_area_stage_t)i, largeWidth, largeHeight);
+
+        DEMO_FitAreaCost(cost, smallPixels, smallCycles, largePixels, largeCycles);
+
+        s_areaCost.fixedCycles += cost->fixedCycles;
+        s_areaCost.pixelCycles256 += cost->pixelCycles256;
+    }
+
+    PRINTF("Area cost: %" LV_PRIu32 " cycles per area, %" LV_PRIu32 "/256 cycles per pixel\r\n",
+        s_areaCost.fixedCycles, s_areaCost.pixelCycles256);
+}
+
+/*
+ * Merge the dirty areas with the measured cost, see DEMO_CoalesceAreas. The
+ * pixels added by the bounding area are the same in both frame buffers, so
+ * processing them again is harmless.
+ */
+static void DEMO_CoalesceDirtyArea(demo_dirty_list_t* list)
+{
+    demo_area_t areas[DEMO_DIRTY_AREA_MAX];
+
+    if (list->fullFrame) {
+        return;
+    }
+
+    for (uint32_t i = 0; i < list->count; i++) {
+        areas[i].x1 = list->areas[i].x1;
+        areas[i].y1 = list->areas[i].y1;
+        areas[i].x2 = list->areas[i].x2;
+        areas[i].y2 = list->areas[i].y2;
+    }
+
+    list->count = DEMO_CoalesceAreas(&s_areaCost, areas, list->count);
+
+    for (uint32_t i = 0; i < list->count; i++) {
+        lv_area_set(&list->areas[i], areas[i].x1, areas[i].y1, areas[i].x2, areas[i].y2);
+    }
+}
+#endif /* DEMO_COALESCE_AREA */
+#endif /* DEMO_TRACK_DIRTY_AREA */
+
+#if DEMO_SYNC_DIRTY_AREA
+
+static void DEMO_CopyArea(uint8_t* dest, const uint8_t* src, uint32_t stride, const lv_area_t* area)
+{
+    uint32_t offset = (uint32_t)area->y1 * stride + (uint32_t)area->x1 * s_fbBytePerPixel;
+    uint32_t lineBytes = (uint32_t)lv_area_get_width(area) * s_fbBytePerPixel;
+
+    for (int32_t y = area->y1; y <= area->y2; y++) {
+        lv_memcpy(dest + offset, src + offset, lineBytes);
+        offset += stride;
+    }
+}
+
+/* Check whether the area will be fully rendered again in this frame. */
+static bool DEMO_IsAreaRedrawn(lv_display_t* disp, const lv_area_t* area)
+{
+    for (uint32_t i = 0; i < disp->inv_p; i++) {
+        if ((disp->inv_area_joined[i] == 0U) && lv_area_is_in(area, &disp->inv_areas[i], 0)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static void DEMO_SyncDirtyAreas(lv_display_t* disp)
+{
+    lv_draw_buf_t* backBuf = lv_display_get_buf_active(disp);
+
+    if ((s_dirtyBuffer != NULL) && (s_dirtyBuffer != backBuf->data)) {
+#if DEMO_FLUSH_ASYNC
+        /* The back buffer is still shown until the pending frame is switched in. */
+        DEMO_WaitFlushDisplay(disp);
+#endif
+
+        LV_PROFILER_BEGIN_TAG("DEMO_SyncDirtyAreas");
+
+#if DEMO_PXP_SYNC
+        /* The last copy must be done before its rectangles are reused. */
+        DEMO_WaitCopyRects();
+        s_copyRectCount = 0U;
+#endif
+
+        for (uint32_t i = 0; i < s_frameDirty.count; i++) {
+            const lv_area_t* dirtyArea = &s_frameDirty.areas[i];
+
+            if (!DEMO_IsAreaRedrawn(disp, dirtyArea)) {
+#if DEMO_PXP_SYNC
+                /* Small areas are faster copied by CPU. */
+                if (DEMO_PXP_IsFaster(kDEMO_PXP_OpCopyRect, s_fbBytePerPixel, (uint32_t)lv_area_get_size(dirtyArea))
+                    && DEMO_AddCopyRects(disp, dirtyArea)) {
+                    continue;
+                }
+#endif
+                DEMO_CopyArea(backBuf->data, s_dirtyBuffer, backBuf->header.stride, dirtyArea);
+#if DEMO_FB_NEED_CLEAN
+                DEMO_CleanFrameBufferRect(backBuf->data, backBuf->header.stride, dirtyArea->x1, dirtyArea->y1,
+                    lv_area_get_width(dirtyArea), lv_area_get_height(dirtyArea));
+#endif
+            }
+        }
+
+#if DEMO_PXP_SYNC
+        /* LVGL renders the other areas while PXP copies. */
+        (void)DEMO_PXP_StartCopyRects(backBuf->data, s_dirtyBuffer, backBuf->header.stride, s_fbBytePerPixel,
+            s_copyRects, s_copyRectCount);
+#endif
+
+        LV_PROFILER_END_TAG("DEMO_SyncDirtyAreas");
+    }
+
+    DEMO_ClearDirtyArea(&s_frameDirty);
+    s_dirtyBuffer = NULL;
+}
+
+static void DEMO_DisplayEventCallback(lv_event_t* e)
+{
+    lv_display_t* disp = (lv_display_t*)lv_event_get_target(e);
+
+    switch (lv_event_get_code(e)) {
+    case LV_EVENT_REFR_START:
+        /* The buffers are synchronized here, drop the areas LVGL would copy itself. */
+        lv_ll_clear(&disp->sync_areas);
+        break;
+
+    case LV_EVENT_RENDER_START:
+        DEMO_SyncDirtyAreas(disp);
+        break;
+
+    default:
+        break;
+    }
+}
+#endif /* DEMO_SYNC_DIRTY_AREA */
+
+#if DEMO_PXP_SYNC
+/*
+ * Split the area into the parts not rendered again in this frame, and append
+ * them to the PXP copy rectangles. The CPU and PXP never write the same pixel,
+ * so they could work at the same time. Return false if there are too many parts,
+ * nothing is appended then.
+ */
+static bool DEMO_AddCopyRects(lv_display_t* disp, const lv_area_t* area)
+{
+    lv_area_t* parts = s_copyParts[0];
+    lv_area_t* nextParts = s_copyParts[1];
+    uint32_t partCount = 1U;
+    uint32_t nextCount;
+
+    parts[0] = *area;
+
+    for (uint32_t i = 0; (i < disp->inv_p) && (partCount > 0U); i++) {
+        const lv_area_t* inv = &disp->inv_areas[i];
+
+        if (disp->inv_area_joined[i] != 0U) {
+            continue;
+        }
+
+        nextCount = 0U;
+
+        for (uint32_t j = 0; j < partCount; j++) {
+            const lv_area_t* part = &parts[j];
+            lv_area_t cut[4];
+            uint32_t cutCount = 0U;
+
+            if ((part->x1 > inv->x2) || (part->x2 < inv->x1) || (part->y1 > inv->y2) || (part->y2 < inv->y1)) {
+                cut[cutCount++] = *part;
+            } else {
+                /* Up to 4 parts are left around the rendered area. */
+                int32_t y1 = LV_MAX(part->y1, inv->y1);
+                int32_t y2 = LV_MIN(part->y2, inv->y2);
+
+                if (inv->y1 > part->y1) {
+                    lv_area_set(&cut[cutCount++], part->x1, part->y1, part->x2, inv->y1 - 1);
+                }
+                if (inv->y2 < part->y2) {
+                    lv_area_set(&cut[cutCount++], part->x1, inv->y2 + 1, part->x2, part->y2);
+                }
+                if (inv->x1 > part->x1) {
+                    lv_area_set(&cut[cutCount++], part->x1, y1, inv->x1 - 1, y2);
+                }
+                if (inv->x2 < part->x2) {
+                    lv_area_set(&cut[cutCount++], inv->x2 + 1, y1, part->x2, y2);
+                }
+            }
+
+            if ((nextCount + cutCount) > DEMO_PXP_COPY_RECT_MAX) {
+                return false;
+            }
+
+            for (uint32_t k = 0; k < cutCount; k++) {
+                nextParts[nextCount++] = cut[k];
+            }
+        }
+
+        /* Ping-pong the two part lists. */
+        lv_area_t* temp = parts;
+        parts = nextParts;
+        nextParts = temp;
+        partCount = nextCount;
+    }
+
+    if ((s_copyRectCount + partCount) > DEMO_PXP_COPY_RECT_MAX) {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < partCount; i++) {
+        demo_pxp_rect_t* rect = &s_copyRects[s_copyRectCount++];
+
+        rect->x = (uint16_t)parts[i].x1;
+        rect->y = (uint16_t)parts[i].y1;
+        rect->width = (uint16_t)lv_area_get_width(&parts[i]);
+        rect->height = (uint16_t)lv_area_get_height(&parts[i]);
+    }
+
+    return true;
+}
+
+/* The frame buffer could only be shown after the PXP copy is done. */
+static void DEMO_WaitCopyRects(void)
+{
+#if DEMO_FRAME_TIMING
+    uint32_t timingPhase = DEMO_TimingSwitch(LV_PORT_TIMING_WAIT);
+#endif
+
+    DEMO_PXP_WaitCopy();
+
+#if DEMO_FRAME_TIMING
+    (void)DEMO_TimingSwitch(timingPhase);
+#endif
+}
+#endif /* DEMO_PXP_SYNC */
+
+#if DEMO_PXP_ROTATE
+/* Rotate the areas of LVGL buffer to the frame buffer with PXP, return after the rotation is done. */
+static void DEMO_RotateAreas(void* frameBuffer, const uint8_t* lvglBuffer, const lv_area_t* areas, uint32_t count)
+{
+    const demo_rotate_image_t srcImage = {
+        .buffer = (void*)lvglBuffer,
+        .strideBytes = LVGL_BUFFER_WIDTH * DEMO_BUFFER_BYTE_PER_PIXEL,
+        .width = LVGL_BUFFER_WIDTH,
+        .height = LVGL_BUFFER_HEIGHT,
+        .bytePerPixel = DEMO_BUFFER_BYTE_PER_PIXEL,
+    };
+    const demo_rotate_image_t destImage = {
+        .buffer = frameBuffer,
+        .strideBytes = DEMO_BUFFER_STRIDE_BYTE,
+        .width = DEMO_BUFFER_WIDTH,
+        .height = DEMO_BUFFER_HEIGHT,
+        .bytePerPixel = DEMO_BUFFER_BYTE_PER_PIXEL,
+    };
+    demo_rotate_rect_t srcRect;
+    demo_rotate_rect_t destRect;
+    uint32_t rectCount = 0U;
+#if DEMO_FRAME_TIMING
+    uint32_t timingPhase;
+#endif
+
+    /* Start the areas rotated by PXP first, the other areas are rotated by CPU meanwhile. */
+    for (uint32_t i = 0; i < count; i++) {
+        srcRect.x = (uint16_t)areas[i].x1;
+        srcRect.y = (uint16_t)areas[i].y1;
+        srcRect.width = (uint16_t)lv_area_get_width(&areas[i]);
+        srcRect.height = (uint16_t)lv_area_get_height(&areas[i]);
+
+        if (!DEMO_PXP_IsFaster(kDEMO_PXP_OpRotate, DEMO_BUFFER_BYTE_PER_PIXEL, lv_area_get_size(&areas[i]))) {
+            continue;
+        }
+
+        /* PXP reads the rendered pixels from memory. */
+        DEMO_CleanFrameBufferRect(
+            lvglBuffer, srcImage.strideBytes, srcRect.x, srcRect.y, srcRect.width, srcRect.height);
+
+        DEMO_GetRotatedRect(&srcImage, &srcRect, kDEMO_Rotate270, &destRect);
+
+        s_rotateRects[rectCount].src.x = srcRect.x;
+        s_rotateRects[rectCount].src.y = srcRect.y;
+        s_rotateRects[rectCount].src.width = srcRect.width;
+        s_rotateRects[rectCount].src.height = srcRect.height;
+        s_rotateRects[rectCount].destX = destRect.x;
+        s_rotateRects[rectCount].destY = destRect.y;
+        rectCount++;
+
+        /* The rectangles are saved in the job, the list is reused for the next job. */
+        if (rectCount == DEMO_PXP_COPY_RECT_MAX) {
+            (void)DEMO_PXP_StartRotateRects(frameBuffer, DEMO_BUFFER_STRIDE_BYTE, lvglBuffer, srcImage.strideBytes,
+                DEMO_BUFFER_BYTE_PER_PIXEL, kPXP_Rotate270, s_rotateRects, rectCount);
+            rectCount = 0U;
+        }
+    }
+
+    (void)DEMO_PXP_StartRotateRects(frameBuffer, DEMO_BUFFER_STRIDE_BYTE, lvglBuffer, srcImage.strideBytes,
+        DEMO_BUFFER_BYTE_PER_PIXEL, kPXP_Rotate270, s_rotateRects, rectCount);
+
+    /* The frame buffer is non-cacheable, nothing to clean after CPU rotation. */
+    for (uint32_t i = 0; i < count; i++) {
+        if (DEMO_PXP_IsFaster(kDEMO_PXP_OpRotate, DEMO_BUFFER_BYTE_PER_PIXEL, lv_area_get_size(&areas[i]))) {
+            continue;
+        }
+
+        srcRect.x = (uint16_t)areas[i].x1;
+        srcRect.y = (uint16_t)areas[i].y1;
+        srcRect.width = (uint16_t)lv_area_get_width(&areas[i]);
+        srcRect.height = (uint16_t)lv_area_get_height(&areas[i]);
+
+        DEMO_RotateRect(&destImage, &srcImage, &srcRect, kDEMO_Rotate270);
+    }
+
+#if DEMO_FRAME_TIMING
+    timingPhase = DEMO_TimingSwitch(LV_PORT_TIMING_WAIT);
+#endif
+
+    DEMO_PXP_WaitRotate();
+
+#if DEMO_FRAME_TIMING
+    (void)DEMO_TimingSwitch(timingPhase);
+#endif
+}
+#endif /* DEMO_PXP_ROTATE */
+
+#if DEMO_VSYNC_SCHEDULE
+/* Called in LCDIFV2 ISR at every vertical blanking. */
+static void DEMO_VsyncCallback(void* param)
+{
+    BaseType_t taskAwake = pdFALSE;
+    uint32_t now = MSDK_GetCpuCycleCount();
+    uint32_t phase;
+
+    LV_UNUSED(param);
+
+    if (s_vsyncCycle != 0U) {
+        s_vsyncPeriod = now - s_vsyncCycle;
+    }
+    s_vsyncCycle = now;
+
+#if DEMO_BEAM_RACE && DEMO_FRAME_TIMING
+    /* No buffer switch in beam racing, the copied bands are shown from this vertical blanking. */
+    DEMO_TimingFlipFrame();
+#endif
+
+    /* The frame passed to display controller before this vertical blanking is shown now. */
+    if (s_frameReady) {
+        s_frameReady = false;
+        phase = now - s_frameReadyCycle;
+
+        if ((s_schedStat.frames == 0U) || (phase < s_schedStat.minPhase)) {
+            s_schedStat.minPhase = phase;
+        }
+        if (phase > s_schedStat.maxPhase) {
+            s_schedStat.maxPhase = phase;
+        }
+        s_schedStat.sumPhase += phase;
+        s_schedStat.frames++;
+    } else {
+        s_schedStat.skippedVsyncs++;
+    }
+
+    /* Don't wake up the LVGL task when there is nothing to render. */
+    if (s_vsyncWait && (s_schedTask != NULL)) {
+        vTaskNotifyGiveFromISR(s_schedTask, &taskAwake);
+        portYIELD_FROM_ISR(taskAwake);
+    }
+}
+
+/* Render ahead time in CPU cycles, it is always less than one period. */
+static uint32_t DEMO_GetRenderAhead(uint32_t period)
+{
+    return (uint32_t)USEC_TO_COUNT(DEMO_RENDER_AHEAD_US, SystemCoreClock) % period;
+}
+
+/*
+ * Get the next render slot. The slot just passed is still returned so that a
+ * little late wake up doesn't miss it, but the slot already used is skipped.
+ */
+static uint32_t DEMO_GetRenderSlot(uint32_t now)
+{
+    uint32_t period = s_vsyncPeriod;
+    uint32_t slot = s_vsyncCycle + period - DEMO_GetRenderAhead(period);
+
+    while (((int32_t)(now - slot) > (int32_t)(period / 2U))
+        || ((int32_t)(slot - s_renderSlot) < (int32_t)(period / 2U))) {
+        slot += period;
+    }
+
+    return slot;
+}
+
+/* Let LVGL refresh the display in this slot. */
+static void DEMO_StartRenderSlot(uint32_t slot)
+{
+    lv_timer_t* refrTimer = lv_display_get_refr_timer(s_schedDisplay);
+
+    s_renderSlot = slot;
+    s_targetCycle = slot + DEMO_GetRenderAhead(s_vsyncPeriod);
+    s_targetValid = true;
+
+    if (refrTimer == NULL) {
+        return;
+    }
+
+    if (refrTimer->paused) {
+        /* Nothing to render, restart the period so that new invalid areas wait for the next slot. */
+        lv_timer_reset(refrTimer);
+    } else {
+        lv_timer_ready(refrTimer);
+    }
+}
+
+/* LVGL has invalid areas to render. */
+static bool DEMO_IsRefreshPending(void)
+{
+    lv_timer_t* refrTimer = lv_display_get_refr_timer(s_schedDisplay);
+
+    return (refrTimer != NULL) && !refrTimer->paused;
+}
+
+/* Called right before the frame is passed to display controller. */
+static void DEMO_MarkFrameReady(void)
+{
+    uint32_t now = MSDK_GetCpuCycleCount();
+
+    if (s_targetValid) {
+        s_targetValid = false;
+
+        if ((int32_t)(now - s_targetCycle) > 0) {
+            s_schedStat.lateFrames++;
+        }
+    }
+
+    s_frameReadyCycle = now;
+    s_frameReady = true;
+}
+
+#if DEMO_SCHED_STAT_PERIOD_MS
+static void DEMO_SchedStatTimerCallback(lv_timer_t* timer)
+{
+    demo_sched_stat_t stat;
+    uint32_t regPrimask;
+
+    LV_UNUSED(timer);
+
+    regPrimask = DisableGlobalIRQ();
+    stat = s_schedStat;
+    lv_memzero(&s_schedStat, sizeof(s_schedStat));
+    EnableGlobalIRQ(regPrimask);
+
+    if (stat.frames == 0U) {
+        PRINTF("Frame to vsync phase: no frame, %" LV_PRIu32 " vsync skipped, %" LV_PRIu32 " empty frames\r\n",
+            stat.skippedVsyncs, s_skippedFrames);
+        return;
+    }
+
+    PRINTF("Frame to vsync phase: %" LV_PRIu32 " frames, %" LV_PRIu32 " vsync skipped, %" LV_PRIu32
+           " empty frames, %" LV_PRIu32 " late, min %" LV_PRIu32 " us, avg %" LV_PRIu32
+           " us, max %" LV_PRIu32 " us, vsync period %" LV_PRIu32 " us\r\n",
+        stat.frames, stat.skippedVsyncs, s_skippedFrames, stat.lateFrames, (uint32_t)COUNT_TO_USEC(stat.minPhase, SystemCoreClock),
+        (uint32_t)COUNT_TO_USEC(stat.sumPhase / stat.frames, SystemCoreClock),
+        (uint32_t)COUNT_TO_USEC(stat.maxPhase, SystemCoreClock),
+        (uint32_t)COUNT_TO_USEC(s_vsyncPeriod, SystemCoreClock));
+}
+#endif
+#endif /* DEMO_VSYNC_SCHEDULE */
+
+#if DEMO_FRAME_TIMING
+/* Charge the time since last switch to the current phase, then enter the new phase. */
+static uint32_t DEMO_TimingSwitch(uint32_t phase)
+{
+    uint32_t now = MSDK_GetCpuCycleCount();
+    uint32_t prevPhase = s_timingPhase;
+
+    s_timingAcc[prevPhase] += now - s_timingStamp;
+    s_timingStamp = now;
+    s_timingPhase = phase;
+
+    return prevPhase;
+}
+
+/* A new frame starts rendering, the frame skipped before is dropped. */
+static void DEMO_TimingEventCallback(lv_event_t* e)
+{
+    LV_UNUSED(e);
+
+    lv_memzero(s_timingAcc, sizeof(s_timingAcc));
+    s_timing[s_timingHead % DEMO_FRAME_TIMING_COUNT].cycles[LV_PORT_TIMING_FLIP] = DEMO_TIMING_INVALID;
+    s_timingStamp = MSDK_GetCpuCycleCount();
+    s_timingPhase = LV_PORT_TIMING_RENDER;
+}
+
+/* Called right before the frame is passed to display controller. */
+static void DEMO_TimingSubmitFrame(void)
+{
+    s_timingFlipSlot = s_timingHead % DEMO_FRAME_TIMING_COUNT;
+    s_timingFlipCycle = MSDK_GetCpuCycleCount();
+    s_timingFlipPending = true;
+}
+
+/* Called in ISR when the frame passed to display controller is shown. */
+static void DEMO_TimingFlipFrame(void)
+{
+    if (s_timingFlipPending) {
+        s_timingFlipPending = false;
+        s_timing[s_timingFlipSlot].cycles[LV_PORT_TIMING_FLIP] = MSDK_GetCpuCycleCount() - s_timingFlipCycle;
+    }
+}
+
+/* The last area of the frame is flushed, publish the frame in the ring. */
+static void DEMO_TimingEndFrame(void)
+{
+    uint32_t head = s_timingHead;
+    demo_frame_timing_t* timing = &s_timing[head % DEMO_FRAME_TIMING_COUNT];
+
+    (void)DEMO_TimingSwitch(DEMO_TIMING_IDLE);
+
+    timing->cycles[LV_PORT_TIMING_RENDER] = s_timingAcc[LV_PORT_TIMING_RENDER];
+    timing->cycles[LV_PORT_TIMING_FLUSH] = s_timingAcc[LV_PORT_TIMING_FLUSH];
+    timing->cycles[LV_PORT_TIMING_CACHE] = s_timingAcc[LV_PORT_TIMING_CACHE];
+    timing->cycles[LV_PORT_TIMING_WAIT] = s_timingAcc[LV_PORT_TIMING_WAIT];
+
+    /* The record must be complete before it is published. */
+    __DMB();
+    s_timingHead = head + 1U;
+}
+
+#if DEMO_FRAME_TIMING_DUMP_PERIOD_MS
+static void DEMO_TimingDumpTimerCallback(lv_timer_t* timer)
+{
+    static const char* const phaseNames[LV_PORT_TIMING_PHASE_COUNT] = {
+        "render",
+        "flush",
+        "cache",
+        "wait",
+        "flip",
+    };
+    lv_port_timing_stat_t stat;
+
+    LV_UNUSED(timer);
+
+#if DEMO_FB_CACHE_COMPARE
+    static bool writeThrough = false;
+    static uint32_t lastHead = 0U;
+    uint32_t head = s_timingHead;
+
+    PRINTF("Frame buffer %s: %" LV_PRIu32 " fps\r\n", writeThrough ? "write through" : "write back",
+        (head - lastHead) * 1000U / DEMO_FRAME_TIMING_DUMP_PERIOD_MS);
+    lastHead = head;
+#endif
+
+    PRINTF("Frame timing min/avg/p99/max us:");
+    for (uint32_t i = 0; i < LV_PORT_TIMING_PHASE_COUNT; i++) {
+        if (lv_port_timing_get((lv_port_timing_phase_t)i, &stat) && (stat.count != 0U)) {
+            PRINTF(" %s %" LV_PRIu32 "/%" LV_PRIu32 "/%" LV_PRIu32 "/%" LV_PRIu32, phaseNames[i], stat.minUs,
+                stat.avgUs, stat.p99Us, stat.maxUs);
+        } else {
+            PRINTF(" %s -", phaseNames[i]);
+        }
+    }
+    PRINTF("\r\n");
+
+#if DEMO_FB_CACHE_COMPARE
+    /* The ring is refilled in the next period, at least DEMO_FRAME_TIMING_COUNT frames are expected. */
+    writeThrough = !writeThrough;
+    BOARD_ConfigFrameBufferMPU((uint32_t)s_frameBuffer, sizeof(s_frameBuffer), writeThrough);
+#endif
+}
+#endif
+#endif /* DEMO_FRAME_TIMING */
+
+#if DEMO_USE_PLANE
+static void DEMO_PlaneSwitchOffCallback(void* param, void* switchOffBuffer)
+{
+    demo_plane_t* plane = (demo_plane_t*)param;
+
+    LV_UNUSED(switchOffBuffer);
+
+    /* The switched off buffer could be drawn now. */
+    lv_display_flush_ready(plane->disp);
+}
+
+/* Called by LVGL before the next flush. */
+static void DEMO_PlaneWaitFlush(lv_display_t* disp)
+{
+    DEMO_FrameSwapWaitFrame(&((demo_plane_t*)lv_display_get_driver_data(disp))->swap);
+}
+
+static void DEMO_PlaneEventCallback(lv_event_t* e)
+{
+    lv_display_t* disp = (lv_display_t*)lv_event_get_target(e);
+
+    /*
+     * LVGL swaps the buffers right after the flush callback, the buffer to be
+     * drawn is still shown until the pending frame is switched in.
+     */
+    DEMO_FrameSwapWaitFrame(&((demo_plane_t*)lv_display_get_driver_data(disp))->swap);
+}
+
+/* The plane uses LV_DISPLAY_RENDER_MODE_FULL, the whole buffer is flushed once per frame. */
+static void DEMO_PlaneFlushCallback(lv_display_t* disp, const lv_area_t* area, uint8_t* px_map)
+{
+    demo_plane_t* plane = (demo_plane_t*)lv_display_get_driver_data(disp);
+    lv_draw_buf_t* drawBuf = lv_display_get_buf_active(disp);
+
+    LV_UNUSED(area);
+
+#if __CORTEX_M == 4
+    L1CACHE_CleanInvalidateSystemCacheByRange((uint32_t)px_map, drawBuf->data_size);
+#else
+    DCACHE_CleanByRange((uint32_t)px_map, drawBuf->data_size);
+#endif
+
+    if (!plane->enabled) {
+        /* The first frame is shown once the layer is enabled. */
+        g_dc.ops->setFrameBuffer(&g_dc, plane->layer, px_map);
+        g_dc.ops->enableLayer(&g_dc, plane->layer);
+        plane->enabled = true;
+        lv_display_flush_ready(disp);
+    } else {
+        /* Flush ready is reported in DEMO_PlaneSwitchOffCallback. */
+        DEMO_FrameSwapSubmit(&plane->swap, px_map);
+    }
+}
+#endif /* DEMO_USE_PLANE */
+
+#if DEMO_BEAM_RACE && !defined(DISABLE_DISPLAY)
+/*
+ * Wait until rows y1 ~ y2 could be written without tearing, see
+ * DEMO_BeamGetWaitCycles. The scanout position is estimated from the vertical
+ * blanking timing.
+ */
+static void DEMO_WaitBeamPassed(int32_t y1, int32_t y2)
+{
+    const dc_fb_lcdifv2_config_t* config = (const dc_fb_lcdifv2_config_t*)g_dc.config;
+    const demo_beam_timing_t timing = {
+        .activeLines = config->height,
+        .blankLines = (uint32_t)config->vfp + config->vsw + config->vbp,
+    };
+    uint32_t vsyncCycle;
+    uint32_t vsyncPeriod;
+    uint32_t regPrimask;
+    uint32_t waitCycles;
+    TickType_t ticks;
+
+    LV_PROFILER_BEGIN_TAG("DEMO_WaitBeamPassed");
+
+    for (;;) {
+        /* The timestamp and the period are updated together in the ISR. */
+        regPrimask = DisableGlobalIRQ();
+        vsyncCycle = s_vsyncCycle;
+        vsyncPeriod = s_vsyncPeriod;
+        EnableGlobalIRQ(regPrimask);
+
+        waitCycles = DEMO_BeamGetWaitCycles(&timing, vsyncCycle, vsyncPeriod, MSDK_GetCpuCycleCount(), y1, y2);
+
+        if (waitCycles == 0U) {
+            break;
+        }
+
+        /* Sleep if the beam is far away, otherwise poll the estimation. */
+        ticks = pdMS_TO_TICKS((uint32_t)COUNT_TO_MSEC(waitCycles, SystemCoreClock));
+        if (ticks > 0U) {
+            vTaskDelay(ticks);
+        }
+    }
+
+    LV_PROFILER_END_TAG("DEMO_WaitBeamPassed");
+}
+
+/*
+ * Copy the band rendered by LVGL to the frame buffer behind the beam, the render
+ * format is converted to the scanout format in the copy.
+ */
+static void DEMO_CopyBand(lv_display_t* disp, const lv_area_t* area, const uint8_t* color_p)
+{
+    int32_t width = lv_area_get_width(area);
+    uint32_t srcStride = lv_draw_buf_width_to_stride(width, lv_display_get_color_format(disp));
+    uint8_t* dest
+        = s_frameBuffer[0] + (uint32_t)area->y1 * s_fbStrideBytes + (uint32_t)area->x1 * s_fbBytePerPixel;
+
+    DEMO_WaitBeamPassed(area->y1, area->y2);
+
+    for (int32_t y = area->y1; y <= area->y2; y++) {
+        DEMO_ConvertLine(dest, s_scanoutFormat, color_p, s_renderFormat, (uint32_t)width);
+        dest += s_fbStrideBytes;
+        color_p += srcStride;
+    }
+
+#if DEMO_FB_NEED_CLEAN
+    DEMO_CleanFrameBufferRect(s_frameBuffer[0], s_fbStrideBytes, area->x1, area->y1, width, lv_area_get_height(area));
+#endif
+}
+#endif /* DEMO_BEAM_RACE */
+
+static void DEMO_FlushDisplay(lv_display_t* disp, const lv_area_t* area, uint8_t* color_p)
+{
+#if DEMO_USE_ROTATE
+
+    /*
+     * Work flow:
+     *
+     * 1. Wait for the available inactive frame buffer to draw.
+     * 2. Draw the ratated frame to inactive buffer.
+     * 3. Pass inactive to LCD controller to show.
+     */
+
+    static bool firstFlush = true;
+
+    /* Only wait for the first time. */
+    if (firstFlush) {
+        firstFlush = false;
     } else {
         /* Wait frame buffer. */
         DEMO_WaitBufferSwitchOff();
@@ -268,74 +1776,207 @@ static void DEMO_FlushDisplay(lv_display_t* disp, const lv_area_t* area, uint8_t
     /* Copy buffer. */
     void* inactiveFrameBuffer = s_inactiveFrameBuffer;
 
-#if __CORTEX_M == 4
-    L1CACHE_CleanInvalidateSystemCacheByRange((uint32_t)s_inactiveFrameBuffer, DEMO_FB_SIZE);
-#else
-    SCB_CleanInvalidateDCache_by_Addr(inactiveFrameBuffer, DEMO_FB_SIZE);
+    uint32_t bufferIndex = (inactiveFrameBuffer == (void*)s_frameBuffer[0]) ? 0U : 1U;
+    demo_dirty_list_t* rotateList = &s_bufferDirty[bufferIndex];
+#if !DEMO_PXP_ROTATE
+    demo_rotate_rect_t rect;
+#if DEMO_FB_NEED_CLEAN
+    demo_rotate_rect_t destRect;
 #endif
 
-#if LV_USE_GPU_NXP_PXP /* Use PXP to rotate the panel. */
-    lv_area_t dest_area = {
-        .x1 = 0,
-        .x2 = DEMO_BUFFER_HEIGHT - 1,
-        .y1 = 0,
-        .y2 = DEMO_BUFFER_WIDTH - 1,
+    const demo_rotate_image_t srcImage = {
+        .buffer = color_p,
+        .strideBytes = LVGL_BUFFER_WIDTH * DEMO_BUFFER_BYTE_PER_PIXEL,
+        .width = LVGL_BUFFER_WIDTH,
+        .height = LVGL_BUFFER_HEIGHT,
+        .bytePerPixel = DEMO_BUFFER_BYTE_PER_PIXEL,
     };
+    const demo_rotate_image_t destImage = {
+        .buffer = inactiveFrameBuffer,
+        .strideBytes = DEMO_BUFFER_STRIDE_BYTE,
+        .width = DEMO_BUFFER_WIDTH,
+        .height = DEMO_BUFFER_HEIGHT,
+        .bytePerPixel = DEMO_BUFFER_BYTE_PER_PIXEL,
+    };
+#endif
 
-    lv_gpu_nxp_pxp_blit(((lv_color_t*)inactiveFrameBuffer), &dest_area, DEMO_BUFFER_WIDTH, color_p, area,
-        lv_area_get_width(area), LV_OPA_COVER, LV_DISP_ROT_270);
-    lv_gpu_nxp_pxp_wait();
-
-#else /* Use CPU to rotate the panel. */
-    for (uint32_t y = 0; y < LVGL_BUFFER_HEIGHT; y++) {
-        for (uint32_t x = 0; x < LVGL_BUFFER_WIDTH; x++) {
-            ((lv_color_t*)inactiveFrameBuffer)[(DEMO_BUFFER_HEIGHT - x) * DEMO_BUFFER_WIDTH + y] = color_p[y * LVGL_BUFFER_WIDTH + x];
-        }
+    /* This frame buffer misses the areas of last frame and this frame. */
+    for (uint32_t i = 0; i < s_frameDirty.count; i++) {
+        DEMO_AddDirtyArea(&s_bufferDirty[0], &s_frameDirty.areas[i]);
+        DEMO_AddDirtyArea(&s_bufferDirty[1], &s_frameDirty.areas[i]);
     }
+    DEMO_ClearDirtyArea(&s_frameDirty);
+#if DEMO_COALESCE_AREA
+    DEMO_CoalesceDirtyArea(rotateList);
 #endif
 
-#if __CORTEX_M == 4
-    L1CACHE_CleanInvalidateSystemCacheByRange((uint32_t)s_inactiveFrameBuffer, DEMO_FB_SIZE);
+    LV_PROFILER_BEGIN_TAG("DEMO_RotateRect");
+#if DEMO_PXP_ROTATE
+    DEMO_RotateAreas(inactiveFrameBuffer, color_p, rotateList->areas, rotateList->count);
 #else
-    SCB_CleanInvalidateDCache_by_Addr(inactiveFrameBuffer, DEMO_FB_SIZE);
+    for (uint32_t i = 0; i < rotateList->count; i++) {
+        rect.x = (uint16_t)rotateList->areas[i].x1;
+        rect.y = (uint16_t)rotateList->areas[i].y1;
+        rect.width = (uint16_t)lv_area_get_width(&rotateList->areas[i]);
+        rect.height = (uint16_t)lv_area_get_height(&rotateList->areas[i]);
+
+        DEMO_RotateRect(&destImage, &srcImage, &rect, kDEMO_Rotate270);
+
+#if DEMO_FB_NEED_CLEAN
+        DEMO_GetRotatedRect(&srcImage, &rect, kDEMO_Rotate270, &destRect);
+        DEMO_CleanFrameBufferRect(
+            inactiveFrameBuffer, DEMO_BUFFER_STRIDE_BYTE, destRect.x, destRect.y, destRect.width, destRect.height);
+#endif
+    }
 #endif
+    DEMO_ClearDirtyArea(rotateList);
+    LV_PROFILER_END_TAG("DEMO_RotateRect");
 
+#if DEMO_VSYNC_SCHEDULE
+    DEMO_MarkFrameReady();
+#endif
+#if DEMO_FRAME_TIMING
+    DEMO_TimingSubmitFrame();
+#endif
     g_dc.ops->setFrameBuffer(&g_dc, 0, inactiveFrameBuffer);
 
-    /* IMPORTANT!!!
-     * Inform the graphics library that you are ready with the flushing*/
-    lv_disp_flush_ready(disp_drv);
+#elif DEMO_BEAM_RACE
+
+    /* Every band is copied to the only frame buffer, nothing to flip. */
+    DEMO_CopyBand(disp, area, color_p);
+
+    if (lv_display_flush_is_last(disp)) {
+#if DEMO_VSYNC_SCHEDULE
+        DEMO_MarkFrameReady();
+#endif
+#if DEMO_FRAME_TIMING
+        DEMO_TimingSubmitFrame();
+#endif
+    }
 
 #else /* DEMO_USE_ROTATE */
 
-#ifndef DEMO_FB_USE_NONCACHEABLE_SECTION
-    LV_PROFILER_BEGIN_TAG("SCB_CleanInvalidateDCache_by_Addr");
-#if __CORTEX_M == 4
-    L1CACHE_CleanInvalidateSystemCacheByRange((uint32_t)color_p, DEMO_FB_SIZE);
-#else
-    SCB_CleanInvalidateDCache_by_Addr(color_p, DEMO_FB_SIZE);
+#if DEMO_FB_NEED_CLEAN
+    /* Only the areas rendered in this frame are written by CPU. */
+    LV_PROFILER_BEGIN_TAG("DEMO_CleanFrameBufferRect");
+    for (uint32_t i = 0; i < s_frameDirty.count; i++) {
+        const lv_area_t* dirtyArea = &s_frameDirty.areas[i];
+
+        DEMO_CleanFrameBufferRect(color_p, s_fbStrideBytes, dirtyArea->x1, dirtyArea->y1,
+            lv_area_get_width(dirtyArea), lv_area_get_height(dirtyArea));
+    }
+    LV_PROFILER_END_TAG("DEMO_CleanFrameBufferRect");
+#endif
+
+#if DEMO_VSYNC_SCHEDULE
+    DEMO_MarkFrameReady();
 #endif
-    LV_PROFILER_END_TAG("SCB_CleanInvalidateDCache_by_Addr");
+#if DEMO_FRAME_TIMING
+    DEMO_TimingSubmitFrame();
 #endif
 
+#if DEMO_FLUSH_ASYNC
+    DEMO_FrameSwapSubmit(&s_frameSwap, (void*)color_p);
+#else
     g_dc.ops->setFrameBuffer(&g_dc, 0, (void*)color_p);
 
     DEMO_WaitBufferSwitchOff();
+#endif
 #endif /* DEMO_USE_ROTATE */
 }
 #endif
 
+/*
+ * LVGL doesn't call flush when nothing is invalidated, so the empty frame never
+ * reaches the flip, rotation or cache maintenance. Only count it here.
+ */
+static void DEMO_FrameEventCallback(lv_event_t* e)
+{
+    switch (lv_event_get_code(e)) {
+    case LV_EVENT_REFR_START:
+        s_frameFlushed = false;
+        break;
+
+    case LV_EVENT_REFR_READY:
+        if (!s_frameFlushed) {
+            s_skippedFrames++;
+        }
+        break;
+
+    default:
+        break;
+    }
+}
+
 static void disp_flush_cb(lv_display_t* disp, const lv_area_t* area, uint8_t* color_p)
 {
+    s_frameFlushed = true;
+
 #ifndef DISABLE_DISPLAY
-    /* Skip the non-last flush */
-    if (lv_display_flush_is_last(disp)) {
+#if DEMO_TRACK_DIRTY_AREA
+    DEMO_AddDirtyArea(&s_frameDirty, area);
+#endif
+#if DEMO_SYNC_DIRTY_AREA
+    s_dirtyBuffer = color_p;
+#endif
+
+    /* Skip the non-last flush, but every band is flushed in beam racing. */
+    if (DEMO_BEAM_RACE || lv_display_flush_is_last(disp)) {
+#if DEMO_PXP_SYNC
+        DEMO_WaitCopyRects();
+#endif
+#if DEMO_COALESCE_AREA
+        DEMO_CoalesceDirtyArea(&s_frameDirty);
+#endif
+#if DEMO_FRAME_TIMING
+        uint32_t timingPhase = DEMO_TimingSwitch(LV_PORT_TIMING_FLUSH);
+#endif
         DEMO_FlushDisplay(disp, area, color_p);
+#if DEMO_FRAME_TIMING
+        (void)DEMO_TimingSwitch(timingPhase);
+        if (lv_display_flush_is_last(disp)) {
+            DEMO_TimingEndFrame();
+        }
+#endif
+#if DEMO_FLUSH_ASYNC
+        /* Flush ready is reported in DEMO_BufferSwitchOffCallback. */
+        return;
+#endif
     }
 #endif
     lv_display_flush_ready(disp);
 }
 
+#if DEMO_PXP_LOCK_RENDER
+/* LVGL draws with the PXP only when rendering, lock the PXP job queue meanwhile. */
+static void DEMO_PXPLockEventCallback(lv_event_t* e)
+{
+    switch (lv_event_get_code(e)) {
+    case LV_EVENT_RENDER_START:
+        DEMO_PXP_Lock();
+        break;
+
+    case LV_EVENT_RENDER_READY:
+        DEMO_PXP_Unlock();
+        break;
+
+    default:
+        break;
+    }
+}
+
+/*
+ * LVGL has drawn the flushed area, the PXP jobs could run in the flush. The
+ * next area is drawn after the flush, so lock again before return.
+ */
+static void DEMO_PXPLockFlushCallback(lv_display_t* disp, const lv_area_t* area, uint8_t* color_p)
+{
+    DEMO_PXP_Unlock();
+    disp_flush_cb(disp, area, color_p);
+    DEMO_PXP_Lock();
+}
+#endif
+
 void gpu_init(void)
 {
     BOARD_PrepareVGLiteController();
@@ -358,11 +1999,39 @@ void gpu_init(void)
 void lv_port_disp_init(void)
 {
     lv_display_t* disp = lv_display_create(LVGL_BUFFER_WIDTH, LVGL_BUFFER_HEIGHT);
+#if DEMO_PXP_LOCK_RENDER
+    lv_display_set_flush_cb(disp, DEMO_PXPLockFlushCallback);
+#else
     lv_display_set_flush_cb(disp, disp_flush_cb);
+#endif
+    s_display = disp;
 
-    lv_color_format_t color_format = DEMO_USE_XRGB8888 ? LV_COLOR_FORMAT_XRGB8888 : LV_COLOR_FORMAT_RGB565;
+    lv_color_format_t color_format = s_renderFormat;
 
     static lv_draw_buf_t draw_buf_1;
+#if DEMO_USE_ROTATE
+    /* LVGL renders in s_lvglBuffer, the frame buffers are filled by rotation. */
+    lv_draw_buf_init(&draw_buf_1,
+        LVGL_BUFFER_WIDTH,
+        LVGL_BUFFER_HEIGHT,
+        color_format,
+        LVGL_BUFFER_WIDTH * DEMO_BUFFER_BYTE_PER_PIXEL,
+        s_lvglBuffer[0],
+        sizeof(s_lvglBuffer[0]));
+
+    lv_display_set_draw_buffers(disp, &draw_buf_1, NULL);
+#elif DEMO_BEAM_RACE
+    /* LVGL renders bands in s_bandBuffer, they are copied to the only frame buffer. */
+    lv_draw_buf_init(&draw_buf_1,
+        LVGL_BUFFER_WIDTH,
+        DEMO_BEAM_BAND_LINES,
+        color_format,
+        LVGL_BUFFER_WIDTH * DEMO_BUFFER_BYTE_PER_PIXEL,
+        s_bandBuffer,
+        sizeof(s_bandBuffer));
+
+    lv_display_set_draw_buffers(disp, &draw_buf_1, NULL);
+#else
     lv_draw_buf_init(&draw_buf_1,
         LVGL_BUFFER_WIDTH,
         LVGL_BUFFER_HEIGHT,
@@ -381,8 +2050,29 @@ void lv_port_disp_init(void)
         sizeof(s_frameBuffer[1]));
 
     lv_display_set_draw_buffers(disp, &draw_buf_1, &draw_buf_2);
+#endif
     lv_display_set_color_format(disp, color_format);
+#if DEMO_BEAM_RACE
+    lv_display_set_render_mode(disp, LV_DISPLAY_RENDER_MODE_PARTIAL);
+#else
     lv_display_set_render_mode(disp, LV_DISPLAY_RENDER_MODE_DIRECT);
+#endif
+
+#if DEMO_FRAME_TIMING
+    /* Added first, so the dirty area synchronization is in the render phase. */
+    lv_display_add_event_cb(disp, DEMO_TimingEventCallback, LV_EVENT_RENDER_START, NULL);
+#endif
+
+    lv_display_add_event_cb(disp, DEMO_FrameEventCallback, LV_EVENT_ALL, NULL);
+
+#if DEMO_PXP_LOCK_RENDER
+    /* Added before the dirty area synchronization, its PXP copy starts in the flush. */
+    lv_display_add_event_cb(disp, DEMO_PXPLockEventCallback, LV_EVENT_ALL, NULL);
+#endif
+
+#if DEMO_SYNC_DIRTY_AREA
+    lv_display_add_event_cb(disp, DEMO_DisplayEventCallback, LV_EVENT_ALL, NULL);
+#endif
 
 #if LV_USE_DRAW_VGLITE
     gpu_init();
@@ -390,7 +2080,6 @@ void lv_port_disp_init(void)
 
 #ifndef DISABLE_DISPLAY
     status_t status;
-    dc_fb_info_t fbInfo;
 
     /*-------------------------
      * Initialize your display
@@ -406,34 +2095,67 @@ void lv_port_disp_init(void)
     DEMO_SetLcdColorPalette();
 #endif
 
-    g_dc.ops->getLayerDefaultConfig(&g_dc, 0, &fbInfo);
-    fbInfo.pixelFormat = DEMO_BUFFER_PIXEL_FORMAT;
-    fbInfo.width = DEMO_BUFFER_WIDTH;
-    fbInfo.height = DEMO_BUFFER_HEIGHT;
-    fbInfo.startX = DEMO_BUFFER_START_X;
-    fbInfo.startY = DEMO_BUFFER_START_Y;
-    fbInfo.strideBytes = DEMO_BUFFER_STRIDE_BYTE;
-    g_dc.ops->setLayerConfig(&g_dc, 0, &fbInfo);
+#if (DEMO_FB_CACHE_MODE != DEMO_FB_NONCACHEABLE) && (__CORTEX_M == 7)
+    BOARD_ConfigFrameBufferMPU(
+        (uint32_t)s_frameBuffer, sizeof(s_frameBuffer), (DEMO_FB_CACHE_MODE == DEMO_FB_WRITE_THROUGH));
+#endif
 
-    g_dc.ops->setCallback(&g_dc, 0, DEMO_BufferSwitchOffCallback, NULL);
+    DEMO_ConfigFrameBufferLayer(DEMO_BUFFER_PIXEL_FORMAT, DEMO_BUFFER_STRIDE_BYTE);
 
-#if defined(SDK_OS_FREE_RTOS)
-    s_transferDone = xSemaphoreCreateBinary();
-    if (NULL == s_transferDone) {
+#if DEMO_FLUSH_ASYNC
+    status = DEMO_FrameSwapInit(&s_frameSwap, &g_dc, 0, DEMO_BufferSwitchOffCallback, disp);
+    lv_display_set_flush_wait_cb(disp, DEMO_WaitFlushDisplay);
+#else
+    status = DEMO_FrameSwapInit(&s_frameSwap, &g_dc, 0, DEMO_BufferSwitchOffCallback, NULL);
+#endif
+    if (kStatus_Success != status) {
         PRINTF("Frame semaphore create failed\r\n");
         assert(0);
     }
+
+#if DEMO_PXP_SYNC || DEMO_PXP_ROTATE || DEMO_PXP_LOCK_RENDER
+    if (kStatus_Success != DEMO_PXP_Init()) {
+        PRINTF("PXP init failed\r\n");
+        assert(0);
+    }
+#endif
+
+#if DEMO_PXP_DISPATCH
+#ifdef DEMO_PXP_CALIB_TABLE
+    if (kStatus_Success != DEMO_PXP_LoadCalib(&s_pxpCalib, DEMO_PXP_CALIB_CONFIG))
+#endif
+    {
+        /* The frame buffers are not shown yet, they could be used by the measurement. */
+#if DEMO_USE_ROTATE
+        DEMO_PXP_Calibrate(s_frameBuffer[0], s_lvglBuffer[0], DEMO_FB_SIZE, DEMO_PXP_CALIB_CONFIG);
 #else
-    s_transferDone = false;
+        DEMO_PXP_Calibrate(s_frameBuffer[1], s_frameBuffer[0], DEMO_FB_SIZE, DEMO_PXP_CALIB_CONFIG);
+#endif
+    }
+#endif
+
+#if DEMO_COALESCE_AREA
+    /* The frame buffers are not shown yet, they could be used by the measurement. */
+    MSDK_EnableCpuCycleCounter();
+    DEMO_CalibrateAreaCost();
 #endif
 
 #if DEMO_USE_ROTATE
     /* s_frameBuffer[1] is first shown in the panel, s_frameBuffer[0] is inactive. */
     s_inactiveFrameBuffer = (void*)s_frameBuffer[0];
+
+    /* Nothing is rotated to the frame buffers yet. */
+    lv_area_t fullArea;
+    lv_area_set(&fullArea, 0, 0, LVGL_BUFFER_WIDTH - 1, LVGL_BUFFER_HEIGHT - 1);
+    DEMO_AddDirtyArea(&s_bufferDirty[0], &fullArea);
+    DEMO_AddDirtyArea(&s_bufferDirty[1], &fullArea);
 #endif
 
-    /* lvgl starts render in frame buffer 0, so show frame buffer 1 first. */
-    g_dc.ops->setFrameBuffer(&g_dc, 0, (void*)s_frameBuffer[1]);
+    /*
+     * lvgl starts render in frame buffer 0, so show frame buffer 1 first.
+     * For beam racing, the only frame buffer is always shown.
+     */
+    g_dc.ops->setFrameBuffer(&g_dc, 0, (void*)s_frameBuffer[DEMO_FB_COUNT - 1]);
 
     /* Wait for frame buffer sent to display controller video memory. */
     if ((g_dc.ops->getProperty(&g_dc) & kDC_FB_ReserveFrameBuffer) == 0) {
@@ -441,6 +2163,368 @@ void lv_port_disp_init(void)
     }
 
     g_dc.ops->enableLayer(&g_dc, 0);
+
+#if DEMO_VSYNC_SCHEDULE
+    s_schedDisplay = disp;
+    s_schedTask = xTaskGetCurrentTaskHandle();
+    s_renderSlot = MSDK_GetCpuCycleCount();
+
+    /* The refresh is triggered in the render slots, the timer is only a fallback. */
+    lv_timer_set_period(lv_display_get_refr_timer(disp), DEMO_SCHED_FALLBACK_PERIOD_MS);
+
+    MSDK_EnableCpuCycleCounter();
+    DC_FB_LCDIFV2_SetVsyncCallback(&g_dc, DEMO_VsyncCallback, NULL);
+
+#if DEMO_SCHED_STAT_PERIOD_MS
+    lv_timer_create(DEMO_SchedStatTimerCallback, DEMO_SCHED_STAT_PERIOD_MS, NULL);
+#endif
+#endif
+
+#if DEMO_FRAME_TIMING
+    MSDK_EnableCpuCycleCounter();
+    s_timingStamp = MSDK_GetCpuCycleCount();
+
+#if DEMO_FRAME_TIMING_DUMP_PERIOD_MS
+    lv_timer_create(DEMO_TimingDumpTimerCallback, DEMO_FRAME_TIMING_DUMP_PERIOD_MS, NULL);
+#endif
+#endif
+#endif
+}
+
+lv_display_t* lv_port_plane_create(
+    uint8_t layer, int32_t x, int32_t y, int32_t width, int32_t height, lv_color_format_t cf)
+{
+#if DEMO_USE_PLANE
+    demo_plane_t* plane;
+    lv_display_t* disp;
+    dc_fb_info_t fbInfo;
+
+    if ((layer == 0U) || (layer >= DC_FB_LCDIFV2_MAX_LAYER) || (s_planes[layer].disp != NULL)) {
+        return NULL;
+    }
+
+    if ((cf != LV_COLOR_FORMAT_RGB565) && (cf != LV_COLOR_FORMAT_ARGB8888)) {
+        return NULL;
+    }
+
+    plane = &s_planes[layer];
+
+    /* The semaphore is created once, it is kept if the draw buffers could not be allocated. */
+    if (kStatus_Success != DEMO_FrameSwapInit(&plane->swap, &g_dc, layer, DEMO_PlaneSwitchOffCallback, plane)) {
+        return NULL;
+    }
+
+    plane->drawBuf[0] = lv_draw_buf_create(width, height, cf, LV_STRIDE_AUTO);
+    plane->drawBuf[1] = lv_draw_buf_create(width, height, cf, LV_STRIDE_AUTO);
+    if ((plane->drawBuf[0] == NULL) || (plane->drawBuf[1] == NULL)) {
+        if (plane->drawBuf[0] != NULL) {
+            lv_draw_buf_destroy(plane->drawBuf[0]);
+        }
+        if (plane->drawBuf[1] != NULL) {
+            lv_draw_buf_destroy(plane->drawBuf[1]);
+        }
+        return NULL;
+    }
+
+    /* The main display created first is still the default display. */
+    disp = lv_display_create(width, height);
+    lv_display_set_color_format(disp, cf);
+    lv_display_set_draw_buffers(disp, plane->drawBuf[0], plane->drawBuf[1]);
+    lv_display_set_render_mode(disp, LV_DISPLAY_RENDER_MODE_FULL);
+    lv_display_set_flush_cb(disp, DEMO_PlaneFlushCallback);
+    lv_display_set_flush_wait_cb(disp, DEMO_PlaneWaitFlush);
+    lv_display_set_driver_data(disp, plane);
+    lv_display_add_event_cb(disp, DEMO_PlaneEventCallback, LV_EVENT_RENDER_START, NULL);
+#if DEMO_PXP_LOCK_RENDER
+    lv_display_add_event_cb(disp, DEMO_PXPLockEventCallback, LV_EVENT_ALL, NULL);
+#endif
+
+    plane->disp = disp;
+    plane->layer = layer;
+    plane->enabled = false;
+    plane->colorFormat = cf;
+
+    g_dc.ops->getLayerDefaultConfig(&g_dc, layer, &fbInfo);
+    fbInfo.pixelFormat = (cf == LV_COLOR_FORMAT_ARGB8888) ? kVIDEO_PixelFormatXRGB8888 : kVIDEO_PixelFormatRGB565;
+    fbInfo.width = (uint16_t)width;
+    fbInfo.height = (uint16_t)height;
+    fbInfo.startX = (uint16_t)x;
+    fbInfo.startY = (uint16_t)y;
+    fbInfo.strideBytes = plane->drawBuf[0]->header.stride;
+    g_dc.ops->setLayerConfig(&g_dc, layer, &fbInfo);
+
+    lv_port_plane_set_opa(disp, LV_OPA_COVER);
+
+    return disp;
+#else
+    LV_UNUSED(layer);
+    LV_UNUSED(x);
+    LV_UNUSED(y);
+    LV_UNUSED(width);
+    LV_UNUSED(height);
+    LV_UNUSED(cf);
+
+    return NULL;
+#endif
+}
+
+void lv_port_plane_set_pos(lv_display_t* disp, int32_t x, int32_t y)
+{
+#if DEMO_USE_PLANE
+    demo_plane_t* plane = (demo_plane_t*)lv_display_get_driver_data(disp);
+
+    DC_FB_LCDIFV2_SetLayerOffset(&g_dc, plane->layer, (uint16_t)x, (uint16_t)y);
+#else
+    LV_UNUSED(disp);
+    LV_UNUSED(x);
+    LV_UNUSED(y);
+#endif
+}
+
+void lv_port_plane_set_opa(lv_display_t* disp, lv_opa_t opa)
+{
+#if DEMO_USE_PLANE
+    demo_plane_t* plane = (demo_plane_t*)lv_display_get_driver_data(disp);
+
+    if (plane->colorFormat != LV_COLOR_FORMAT_ARGB8888) {
+        plane->blend.alphaMode = kLCDIFV2_AlphaOverride;
+    } else if (opa == LV_OPA_COVER) {
+        plane->blend.alphaMode = kLCDIFV2_AlphaEmbedded;
+    } else {
+        /* Both the pixel alpha and the plane opacity are used. */
+        (void)LCDIFV2_GetPorterDuffConfig(kLCDIFV2_PD_Over, kLCDIFV2_PD_SrcLayer, &plane->blend);
+        plane->blend.pdGlobalAlphaMode = kLCDIFV2_PD_ScaledAlpha;
+    }
+    plane->blend.globalAlpha = opa;
+
+    DC_FB_LCDIFV2_SetLayerBlend(&g_dc, plane->layer, &plane->blend);
+#else
+    LV_UNUSED(disp);
+    LV_UNUSED(opa);
+#endif
+}
+
+bool lv_port_disp_set_format(lv_color_format_t renderFormat, lv_color_format_t scanoutFormat)
+{
+    lv_display_t* disp = s_display;
+    uint32_t renderBytePerPixel = lv_color_format_get_size(renderFormat);
+    uint32_t scanoutBytePerPixel = lv_color_format_get_size(scanoutFormat);
+
+    if (!DEMO_IsFormatSupported(renderFormat) || !DEMO_IsFormatSupported(scanoutFormat)) {
+        return false;
+    }
+
+    /* The frame buffers are too small. */
+    if (scanoutBytePerPixel > DEMO_BUFFER_BYTE_PER_PIXEL) {
+        return false;
+    }
+
+#if DEMO_USE_ROTATE
+    /* The rotation copies the pixels as is. */
+    LV_UNUSED(disp);
+    LV_UNUSED(renderBytePerPixel);
+
+    return (renderFormat == s_renderFormat) && (scanoutFormat == s_scanoutFormat);
+#else
+
+#if DEMO_BEAM_RACE
+    /* Only the band buffer is rendered by LVGL, less lines if the render format is wider. */
+    lv_draw_buf_init(disp->buf_1,
+        LVGL_BUFFER_WIDTH,
+        sizeof(s_bandBuffer) / (LVGL_BUFFER_WIDTH * renderBytePerPixel),
+        renderFormat,
+        LVGL_BUFFER_WIDTH * renderBytePerPixel,
+        s_bandBuffer,
+        sizeof(s_bandBuffer));
+#else
+    /* LVGL renders in the frame buffers directly, no conversion could be done. */
+    if (renderFormat != scanoutFormat) {
+        return false;
+    }
+
+#if DEMO_FLUSH_ASYNC
+    /* The frame buffer in flight is not touched. */
+    DEMO_WaitFlushDisplay(disp);
+#endif
+#if DEMO_PXP_SYNC
+    DEMO_PXP_WaitCopy();
+#endif
+
+    lv_draw_buf_init(disp->buf_1,
+        LVGL_BUFFER_WIDTH,
+        LVGL_BUFFER_HEIGHT,
+        renderFormat,
+        LVGL_BUFFER_WIDTH * renderBytePerPixel,
+        s_frameBuffer[0],
+        sizeof(s_frameBuffer[0]));
+    lv_draw_buf_init(disp->buf_2,
+        LVGL_BUFFER_WIDTH,
+        LVGL_BUFFER_HEIGHT,
+        renderFormat,
+        LVGL_BUFFER_WIDTH * renderBytePerPixel,
+        s_frameBuffer[1],
+        sizeof(s_frameBuffer[1]));
+#endif
+
+#if DEMO_TRACK_DIRTY_AREA
+    /* The whole screen is rendered again, the old dirty areas are useless. */
+    DEMO_ClearDirtyArea(&s_frameDirty);
+#endif
+
+    lv_display_set_color_format(disp, renderFormat);
+
+    s_renderFormat = renderFormat;
+    s_scanoutFormat = scanoutFormat;
+    s_fbBytePerPixel = (uint8_t)scanoutBytePerPixel;
+    s_fbStrideBytes = DEMO_BUFFER_WIDTH * scanoutBytePerPixel;
+
+#ifndef DISABLE_DISPLAY
+    DEMO_ConfigFrameBufferLayer(
+        (scanoutFormat == LV_COLOR_FORMAT_XRGB8888) ? kVIDEO_PixelFormatXRGB8888 : kVIDEO_PixelFormatRGB565,
+        s_fbStrideBytes);
+
+#if DEMO_BEAM_RACE
+    /* The only frame buffer is not flipped, load the new layer configuration explicitly. */
+    g_dc.ops->setFrameBuffer(&g_dc, 0, (void*)s_frameBuffer[0]);
+#endif
+#endif
+
+    lv_obj_invalidate(lv_display_get_screen_active(disp));
+
+    return true;
+#endif /* DEMO_USE_ROTATE */
+}
+
+bool lv_port_timing_get(lv_port_timing_phase_t phase, lv_port_timing_stat_t* stat)
+{
+#if DEMO_FRAME_TIMING
+    uint32_t samples[DEMO_FRAME_TIMING_COUNT];
+    uint32_t head;
+    uint32_t newHead;
+    uint32_t first;
+    uint32_t start;
+    uint32_t count = 0U;
+    uint64_t sum = 0U;
+
+    if ((uint32_t)phase >= LV_PORT_TIMING_PHASE_COUNT) {
+        return false;
+    }
+
+    lv_memzero(stat, sizeof(*stat));
+
+    /* The slot after the newest record is left out, it is being written. */
+    head = s_timingHead;
+    first = (head > (DEMO_FRAME_TIMING_COUNT - 1U)) ? (head - (DEMO_FRAME_TIMING_COUNT - 1U)) : 0U;
+    for (uint32_t i = first; i < head; i++) {
+        samples[i - first] = s_timing[i % DEMO_FRAME_TIMING_COUNT].cycles[phase];
+    }
+
+    /* Drop the records overwritten by the frames published meanwhile. */
+    __DMB();
+    newHead = s_timingHead;
+    start = ((newHead - first) > (DEMO_FRAME_TIMING_COUNT - 1U)) ? (newHead - first - (DEMO_FRAME_TIMING_COUNT - 1U))
+                                                                   : 0U;
+
+    for (uint32_t i = start; i < (head - first); i++) {
+        if (samples[i] != DEMO_TIMING_INVALID) {
+            sum += samples[i];
+            samples[count++] = samples[i];
+        }
+    }
+
+    if (count == 0U) {
+        return true;
+    }
+
+    /* Insertion sort, the ring is small. */
+    for (uint32_t i = 1U; i < count; i++) {
+        uint32_t cycles = samples[i];
+        uint32_t j = i;
+
+        while ((j > 0U) && (samples[j - 1U] > cycles)) {
+            samples[j] = samples[j - 1U];
+            j--;
+        }
+        samples[j] = cycles;
+    }
+
+    for (uint32_t i = 0U; i < count; i++) {
+        uint32_t us = (uint32_t)COUNT_TO_USEC(samples[i], SystemCoreClock);
+        uint32_t bin = (us == 0U) ? 0U : (32U - __CLZ(us));
+
+        stat->hist[LV_MIN(bin, LV_PORT_TIMING_HIST_BINS - 1U)]++;
+    }
+
+    stat->count = count;
+    stat->minUs = (uint32_t)COUNT_TO_USEC(samples[0], SystemCoreClock);
+    stat->avgUs = (uint32_t)COUNT_TO_USEC(sum / count, SystemCoreClock);
+    stat->p99Us = (uint32_t)COUNT_TO_USEC(samples[(count * 99U + 99U) / 100U - 1U], SystemCoreClock);
+    stat->maxUs = (uint32_t)COUNT_TO_USEC(samples[count - 1U], SystemCoreClock);
+
+    return true;
+#else
+    LV_UNUSED(phase);
+    LV_UNUSED(stat);
+
+    return false;
+#endif
+}
+
+void lv_port_sched_wait(uint32_t idle)
+{
+#if DEMO_VSYNC_SCHEDULE
+    uint32_t now = MSDK_GetCpuCycleCount();
+    uint32_t deadline;
+    uint32_t slot = 0U;
+    uint32_t wait;
+    TickType_t ticks;
+    bool isSlot;
+
+    if (idle > DEMO_SCHED_MAX_IDLE_MS) {
+        idle = DEMO_SCHED_MAX_IDLE_MS;
+    }
+    deadline = now + (uint32_t)MSEC_TO_COUNT(idle, SystemCoreClock);
+
+    for (;;) {
+        now = MSDK_GetCpuCycleCount();
+
+        /* LVGL timer is ready. */
+        if ((int32_t)(deadline - now) <= 0) {
+            break;
+        }
+
+        if ((s_vsyncPeriod == 0U) || !DEMO_IsRefreshPending()) {
+            /* Vertical blanking period not measured yet, or nothing to render. */
+            isSlot = false;
+            wait = deadline - now;
+        } else {
+            slot = DEMO_GetRenderSlot(now);
+            isSlot = ((int32_t)(slot - deadline) <= 0);
+            if (isSlot) {
+                wait = ((int32_t)(slot - now) > 0) ? (slot - now) : 0U;
+            } else {
+                wait = deadline - now;
+            }
+        }
+
+        /* Less than one tick is treated as reached. */
+        ticks = pdMS_TO_TICKS((uint32_t)COUNT_TO_MSEC(wait, SystemCoreClock));
+        if (ticks == 0U) {
+            if (isSlot) {
+                DEMO_StartRenderSlot(slot);
+            }
+            break;
+        }
+
+        /* Woken up by the vertical blanking or timeout, then check again. */
+        s_vsyncWait = isSlot;
+        (void)ulTaskNotifyTake(pdTRUE, ticks);
+        s_vsyncWait = false;
+    }
+#elif defined(SDK_OS_FREE_RTOS)
+    vTaskDelay(idle);
+#else
+    LV_UNUSED(idle);
 #endif
 }
 
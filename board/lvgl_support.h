@@ -10,6 +10,7 @@
 
 #include <stdint.h>
 #include "display_support.h"
+#include "lvgl/lvgl.h"
 
 /*******************************************************************************
  * Definitions
@@ -19,6 +20,28 @@
 #define LCD_HEIGHT            DEMO_BUFFER_HEIGHT
 #define LCD_FB_BYTE_PER_PIXEL DEMO_BUFFER_BYTE_PER_PIXEL
 
+/* Frame phases measured when DEMO_FRAME_TIMING is enabled, every cycle is charged to one phase. */
+typedef enum _lv_port_timing_phase {
+    LV_PORT_TIMING_RENDER = 0, /* LVGL rendering, including the dirty area synchronization. */
+    LV_PORT_TIMING_FLUSH,      /* Flush, rotation or band copy, excluding cache maintenance and wait. */
+    LV_PORT_TIMING_CACHE,      /* Frame buffer cache clean. */
+    LV_PORT_TIMING_WAIT,       /* Blocked in waiting for the frame buffer switched off. */
+    LV_PORT_TIMING_FLIP,       /* From the frame passed to display controller to it is shown. */
+    LV_PORT_TIMING_PHASE_COUNT,
+} lv_port_timing_phase_t;
+
+/* hist[0] counts the samples less than 1us, hist[i] counts [2^(i-1), 2^i) us, the last one includes longer. */
+#define LV_PORT_TIMING_HIST_BINS 16U
+
+typedef struct _lv_port_timing_stat {
+    uint32_t count; /* Frames measured. */
+    uint32_t minUs;
+    uint32_t avgUs;
+    uint32_t p99Us;
+    uint32_t maxUs;
+    uint32_t hist[LV_PORT_TIMING_HIST_BINS];
+} lv_port_timing_stat_t;
+
 /*******************************************************************************
  * API
  ******************************************************************************/
@@ -33,6 +56,53 @@ void lv_port_indev_init(void);
 void lv_port_profiler_init(void);
 void lv_port_draw_buf_init(void);
 
+/*
+ * Select the LVGL render format and the frame buffer (scanout) format at
+ * runtime, LV_COLOR_FORMAT_RGB565 or LV_COLOR_FORMAT_XRGB8888. RGB565 scanout
+ * halves the display controller memory bandwidth. The frame buffers are sized
+ * by DEMO_BUFFER_BYTE_PER_PIXEL, wider scanout format is refused.
+ *
+ * The two formats could only differ in beam racing mode, where the render
+ * format is converted in the band copy. The format can't be changed when the
+ * panel is rotated. Return false if the combination is refused.
+ */
+bool lv_port_disp_set_format(lv_color_format_t renderFormat, lv_color_format_t scanoutFormat);
+
+/*
+ * Get the statistics of one phase over the recent frames in the timing ring.
+ * It could be called from any task. The flip time is not measured in beam
+ * racing mode, count is 0 then. Return false if the frame timing is disabled.
+ */
+bool lv_port_timing_get(lv_port_timing_phase_t phase, lv_port_timing_stat_t* stat);
+
+/*
+ * Wait until the next LVGL timer is ready (idle ms passed) or the next render
+ * slot comes. It should be called in the LVGL task after lv_task_handler.
+ */
+void lv_port_sched_wait(uint32_t idle);
+
+/*
+ * Create a LVGL display shown in the LCDIFV2 hardware layer, which is blended
+ * over the main display (layer 0) at (x, y). Only the content of this display
+ * is rendered when it is invalidated, so a small dynamic part of the UI could be
+ * put here, and the main display keeps the static part without re-rendering.
+ * Use lv_display_get_screen_active or the display layers to put the widgets.
+ * For LV_COLOR_FORMAT_ARGB8888, the pixel alpha is used, the screen background
+ * should be transparent.
+ *
+ * It should be called after lv_port_disp_init. Return NULL if the layer is
+ * used, the color format is not supported, or the memory is not enough. Only
+ * available with LCDIFV2.
+ */
+lv_display_t* lv_port_plane_create(
+    uint8_t layer, int32_t x, int32_t y, int32_t width, int32_t height, lv_color_format_t cf);
+
+/* Move the plane, it takes effect at next vertical blanking. */
+void lv_port_plane_set_pos(lv_display_t* disp, int32_t x, int32_t y);
+
+/* Set the plane opacity, it takes effect at next vertical blanking. */
+void lv_port_plane_set_opa(lv_display_t* disp, lv_opa_t opa);
+
 #if defined(__cplusplus)
 }
 #endif
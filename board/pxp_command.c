@@ -0,0 +1,118 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "pxp_command.h"
+#if defined(FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET) && FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET
+#include "fsl_memory.h"
+#endif
+
+/*
+ * The builder only writes the command memory, no register is accessed, so it
+ * could be built and checked on host with the register definitions.
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#if defined(FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET) && FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET
+#define DEMO_PXP_CMD_ADDR(addr) (MEMORY_ConvertMemoryMapAddress((uint32_t)(addr), kMEMORY_Local2DMA))
+#else
+#define DEMO_PXP_CMD_ADDR(addr) (addr)
+#endif
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+void DEMO_PXP_CmdInitRect(demo_pxp_cmd_t *cmd, pxp_as_pixel_format_t pixelFormat, pxp_rotate_degree_t degree)
+{
+    *cmd = (demo_pxp_cmd_t)DEMO_PXP_CMD_RECT_INIT(pixelFormat, degree);
+}
+
+void DEMO_PXP_CmdSetRect(demo_pxp_cmd_t *cmd,
+                         uint32_t destAddr,
+                         uint16_t destPitchBytes,
+                         uint32_t srcAddr,
+                         uint16_t srcPitchBytes,
+                         uint16_t width,
+                         uint16_t height)
+{
+    cmd->reg[kDEMO_PXP_CmdOutBuf]   = DEMO_PXP_CMD_ADDR(destAddr);
+    cmd->reg[kDEMO_PXP_CmdOutPitch] = destPitchBytes;
+    cmd->reg[kDEMO_PXP_CmdOutLrc]   = PXP_OUT_LRC_Y((uint32_t)height - 1U) | PXP_OUT_LRC_X((uint32_t)width - 1U);
+    cmd->reg[kDEMO_PXP_CmdOutAsUlc] = PXP_OUT_AS_ULC_Y(0U) | PXP_OUT_AS_ULC_X(0U);
+    cmd->reg[kDEMO_PXP_CmdOutAsLrc] =
+        PXP_OUT_AS_LRC_Y((uint32_t)height - 1U) | PXP_OUT_AS_LRC_X((uint32_t)width - 1U);
+    cmd->reg[kDEMO_PXP_CmdAsBuf]    = DEMO_PXP_CMD_ADDR(srcAddr);
+    cmd->reg[kDEMO_PXP_CmdAsPitch]  = srcPitchBytes;
+}
+
+void DEMO_PXP_CmdInitBlend(demo_pxp_cmd_t *cmd,
+                           pxp_output_pixel_format_t destFormat,
+                           pxp_ps_pixel_format_t psFormat,
+                           pxp_as_pixel_format_t srcFormat)
+{
+    *cmd = (demo_pxp_cmd_t)DEMO_PXP_CMD_RECT_INIT(srcFormat, kPXP_Rotate0);
+
+    cmd->reg[kDEMO_PXP_CmdOutCtrl] = PXP_OUT_CTRL_FORMAT(destFormat);
+    cmd->reg[kDEMO_PXP_CmdPsCtrl]  = PXP_PS_CTRL_FORMAT(psFormat);
+    cmd->reg[kDEMO_PXP_CmdAsCtrl]  = PXP_AS_CTRL_FORMAT(srcFormat) | PXP_AS_CTRL_ALPHA_CTRL(kPXP_AlphaEmbedded);
+}
+
+void DEMO_PXP_CmdSetBlend(demo_pxp_cmd_t *cmd,
+                          uint32_t destAddr,
+                          uint16_t destPitchBytes,
+                          uint32_t srcAddr,
+                          uint16_t srcPitchBytes,
+                          uint16_t width,
+                          uint16_t height)
+{
+    DEMO_PXP_CmdSetRect(cmd, destAddr, destPitchBytes, srcAddr, srcPitchBytes, width, height);
+
+    /* PS covers the output, it reads the destination. */
+    cmd->reg[kDEMO_PXP_CmdOutPsUlc] = PXP_OUT_PS_ULC_Y(0U) | PXP_OUT_PS_ULC_X(0U);
+    cmd->reg[kDEMO_PXP_CmdOutPsLrc] =
+        PXP_OUT_PS_LRC_Y((uint32_t)height - 1U) | PXP_OUT_PS_LRC_X((uint32_t)width - 1U);
+    cmd->reg[kDEMO_PXP_CmdPsBuf]   = DEMO_PXP_CMD_ADDR(destAddr);
+    cmd->reg[kDEMO_PXP_CmdPsPitch] = destPitchBytes;
+}
+
+void DEMO_PXP_CmdInitScale(demo_pxp_cmd_t *cmd, pxp_output_pixel_format_t destFormat, pxp_ps_pixel_format_t srcFormat)
+{
+    *cmd = (demo_pxp_cmd_t)DEMO_PXP_CMD_RECT_INIT(kPXP_AsPixelFormatRGB565, kPXP_Rotate0);
+
+    cmd->reg[kDEMO_PXP_CmdOutCtrl]  = PXP_OUT_CTRL_FORMAT(destFormat);
+    cmd->reg[kDEMO_PXP_CmdOutAsUlc] = PXP_OUT_AS_ULC_Y(0xFFFFU) | PXP_OUT_AS_ULC_X(0xFFFFU);
+    cmd->reg[kDEMO_PXP_CmdPsCtrl]   = PXP_PS_CTRL_FORMAT(srcFormat);
+}
+
+void DEMO_PXP_CmdSetScale(demo_pxp_cmd_t *cmd,
+                          uint32_t destAddr,
+                          uint16_t destPitchBytes,
+                          uint32_t srcAddr,
+                          uint16_t srcPitchBytes,
+                          uint16_t width,
+                          uint16_t height,
+                          const pxp_ps_scaler_config_t *scaler,
+                          uint16_t offsetX,
+                          uint16_t offsetY)
+{
+    uint32_t psCtrl = cmd->reg[kDEMO_PXP_CmdPsCtrl] & ~(PXP_PS_CTRL_DECX_MASK | PXP_PS_CTRL_DECY_MASK);
+
+    cmd->reg[kDEMO_PXP_CmdOutBuf]   = DEMO_PXP_CMD_ADDR(destAddr);
+    cmd->reg[kDEMO_PXP_CmdOutPitch] = destPitchBytes;
+    cmd->reg[kDEMO_PXP_CmdOutLrc]   = PXP_OUT_LRC_Y((uint32_t)height - 1U) | PXP_OUT_LRC_X((uint32_t)width - 1U);
+    cmd->reg[kDEMO_PXP_CmdOutPsUlc] = PXP_OUT_PS_ULC_Y(0U) | PXP_OUT_PS_ULC_X(0U);
+    cmd->reg[kDEMO_PXP_CmdOutPsLrc] =
+        PXP_OUT_PS_LRC_Y((uint32_t)height - 1U) | PXP_OUT_PS_LRC_X((uint32_t)width - 1U);
+    cmd->reg[kDEMO_PXP_CmdPsCtrl]   = psCtrl | PXP_PS_CTRL_DECX(scaler->decX) | PXP_PS_CTRL_DECY(scaler->decY);
+    cmd->reg[kDEMO_PXP_CmdPsBuf]    = DEMO_PXP_CMD_ADDR(srcAddr);
+    cmd->reg[kDEMO_PXP_CmdPsPitch]  = srcPitchBytes;
+    cmd->reg[kDEMO_PXP_CmdPsScale]  = PXP_PS_SCALE_YSCALE(scaler->scaleY) | PXP_PS_SCALE_XSCALE(scaler->scaleX);
+    cmd->reg[kDEMO_PXP_CmdPsOffset] = PXP_PS_OFFSET_YOFFSET(offsetY) | PXP_PS_OFFSET_XOFFSET(offsetX);
+}
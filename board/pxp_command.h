@@ -0,0 +1,221 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _PXP_COMMAND_H_
+#define _PXP_COMMAND_H_
+
+#include "fsl_common.h"
+#include "fsl_pxp.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*
+ * Words in one command, the PXP loads them from the address written to NEXT.
+ * They are the registers from CTRL to the one before NEXT, in the order of the
+ * register map, without STAT, NEXT and the CSC coefficients.
+ */
+#define DEMO_PXP_CMD_WORDS 48U
+
+/*! @brief Position of the registers in a command. */
+enum _demo_pxp_cmd_reg
+{
+    kDEMO_PXP_CmdCtrl = 0U,
+    kDEMO_PXP_CmdOutCtrl,
+    kDEMO_PXP_CmdOutBuf,
+    kDEMO_PXP_CmdOutBuf2,
+    kDEMO_PXP_CmdOutPitch,
+    kDEMO_PXP_CmdOutLrc,
+    kDEMO_PXP_CmdOutPsUlc,
+    kDEMO_PXP_CmdOutPsLrc,
+    kDEMO_PXP_CmdOutAsUlc,
+    kDEMO_PXP_CmdOutAsLrc,
+    kDEMO_PXP_CmdPsCtrl,
+    kDEMO_PXP_CmdPsBuf,
+    kDEMO_PXP_CmdPsUbuf,
+    kDEMO_PXP_CmdPsVbuf,
+    kDEMO_PXP_CmdPsPitch,
+    kDEMO_PXP_CmdPsBackground,
+    kDEMO_PXP_CmdPsScale,
+    kDEMO_PXP_CmdPsOffset,
+    kDEMO_PXP_CmdPsClrKeyLow,
+    kDEMO_PXP_CmdPsClrKeyHigh,
+    kDEMO_PXP_CmdAsCtrl,
+    kDEMO_PXP_CmdAsBuf,
+    kDEMO_PXP_CmdAsPitch,
+    kDEMO_PXP_CmdAsClrKeyLow,
+    kDEMO_PXP_CmdAsClrKeyHigh,
+    kDEMO_PXP_CmdRegCount, /* Registers after this are not used here, they are kept 0 as reset value. */
+};
+
+/* The processing engines enabled by PXP_ResetControl. */
+#if defined(PXP_CTRL_ENABLE_PS_AS_OUT_MASK)
+#define DEMO_PXP_CMD_CTRL_ENGINES (PXP_CTRL_ENABLE_ROTATE0_MASK | PXP_CTRL_ENABLE_PS_AS_OUT_MASK)
+#else
+#define DEMO_PXP_CMD_CTRL_ENGINES 0U
+#endif
+
+/* CTRL of a command: start at once with the completion interrupt, the output is rotated. */
+#if defined(PXP_CTRL_ROT_POS_MASK)
+#define DEMO_PXP_CMD_CTRL(degree)                                                  \
+    (PXP_CTRL_ENABLE_MASK | PXP_CTRL_IRQ_ENABLE_MASK | DEMO_PXP_CMD_CTRL_ENGINES | \
+     PXP_CTRL_ROTATE(degree) | PXP_CTRL_ROT_POS(kPXP_RotateOutputBuffer))
+#else
+#define DEMO_PXP_CMD_CTRL(degree) \
+    (PXP_CTRL_ENABLE_MASK | PXP_CTRL_IRQ_ENABLE_MASK | DEMO_PXP_CMD_CTRL_ENGINES | PXP_CTRL_ROTATE0(degree))
+#endif
+
+/*
+ * Command copying or rotating the AS to the output, PS disabled, the AS is
+ * merged by ROP. Color keys are disabled by low key larger than high key.
+ * It is a constant expression, the buffers and size are set by
+ * DEMO_PXP_CmdSetRect.
+ *
+ * @param format The AS pixel format, output uses the same format.
+ * @param degree The clockwise rotate degree.
+ */
+#define DEMO_PXP_CMD_RECT_INIT(format, degree)                                                                \
+    {                                                                                                         \
+        .reg = {                                                                                              \
+            [kDEMO_PXP_CmdCtrl]        = DEMO_PXP_CMD_CTRL(degree),                                           \
+            [kDEMO_PXP_CmdOutCtrl]     = PXP_OUT_CTRL_FORMAT(format),                                         \
+            [kDEMO_PXP_CmdOutPsUlc]    = PXP_OUT_PS_ULC_Y(0xFFFFU) | PXP_OUT_PS_ULC_X(0xFFFFU),               \
+            [kDEMO_PXP_CmdPsScale]     = PXP_PS_SCALE_YSCALE(0x1000U) | PXP_PS_SCALE_XSCALE(0x1000U),         \
+            [kDEMO_PXP_CmdPsClrKeyLow] = 0xFFFFFFU,                                                           \
+            [kDEMO_PXP_CmdAsCtrl]      = PXP_AS_CTRL_FORMAT(format) | PXP_AS_CTRL_ALPHA_CTRL(kPXP_AlphaRop) | \
+                                         PXP_AS_CTRL_ROP(kPXP_RopMergeAs),                                    \
+            [kDEMO_PXP_CmdAsClrKeyLow] = 0xFFFFFFU,                                                           \
+        },                                                                                                    \
+    }
+
+/*!
+ * @brief PXP command, the register image of one operation.
+ *
+ * It is built in memory ahead of time, then started by one write of the NEXT
+ * register. The PORTER_DUFF_CTRL register is not in the command, it must be
+ * disabled when a command is started.
+ */
+typedef struct _demo_pxp_cmd
+{
+    uint32_t reg[DEMO_PXP_CMD_WORDS]; /*!< Register values, indexed by _demo_pxp_cmd_reg. */
+} demo_pxp_cmd_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * @brief Build a rectangle copy or rotation command.
+ *
+ * Same with DEMO_PXP_CMD_RECT_INIT, used when the format or degree is only known at runtime.
+ *
+ * @param cmd The command.
+ * @param pixelFormat Pixel format of the input and output.
+ * @param degree Clockwise rotate degree.
+ */
+void DEMO_PXP_CmdInitRect(demo_pxp_cmd_t *cmd, pxp_as_pixel_format_t pixelFormat, pxp_rotate_degree_t degree);
+
+/*!
+ * @brief Set the buffers and size of a rectangle command.
+ *
+ * Only integer stores to the command, it could be called in interrupt.
+ *
+ * @param cmd The command built by DEMO_PXP_CMD_RECT_INIT or @ref DEMO_PXP_CmdInitRect.
+ * @param destAddr Address of the first output pixel.
+ * @param destPitchBytes Stride of the output in bytes.
+ * @param srcAddr Address of the first input pixel.
+ * @param srcPitchBytes Stride of the input in bytes.
+ * @param width Width before rotation.
+ * @param height Height before rotation.
+ */
+void DEMO_PXP_CmdSetRect(demo_pxp_cmd_t *cmd,
+                         uint32_t destAddr,
+                         uint16_t destPitchBytes,
+                         uint32_t srcAddr,
+                         uint16_t srcPitchBytes,
+                         uint16_t width,
+                         uint16_t height);
+
+/*!
+ * @brief Build a blend command, the AS is blended onto the PS which reads the output buffer.
+ *
+ * The blending is set by the Porter-Duff configuration, which is not part of the command.
+ *
+ * @param cmd The command.
+ * @param destFormat Pixel format of the output.
+ * @param psFormat Pixel format to read the output buffer as PS.
+ * @param srcFormat Pixel format of the AS.
+ */
+void DEMO_PXP_CmdInitBlend(demo_pxp_cmd_t *cmd,
+                           pxp_output_pixel_format_t destFormat,
+                           pxp_ps_pixel_format_t psFormat,
+                           pxp_as_pixel_format_t srcFormat);
+
+/*!
+ * @brief Set the buffers and size of a blend command.
+ *
+ * @param cmd The command built by @ref DEMO_PXP_CmdInitBlend.
+ * @param destAddr Address of the first destination pixel, it is both PS and output.
+ * @param destPitchBytes Stride of the destination in bytes.
+ * @param srcAddr Address of the first AS pixel.
+ * @param srcPitchBytes Stride of the AS in bytes.
+ * @param width Width in pixel.
+ * @param height Height in pixel.
+ */
+void DEMO_PXP_CmdSetBlend(demo_pxp_cmd_t *cmd,
+                          uint32_t destAddr,
+                          uint16_t destPitchBytes,
+                          uint32_t srcAddr,
+                          uint16_t srcPitchBytes,
+                          uint16_t width,
+                          uint16_t height);
+
+/*!
+ * @brief Build a scale command, the PS is scaled to the output, AS disabled.
+ *
+ * @param cmd The command.
+ * @param destFormat Pixel format of the output.
+ * @param srcFormat Pixel format of the PS.
+ */
+void DEMO_PXP_CmdInitScale(demo_pxp_cmd_t *cmd, pxp_output_pixel_format_t destFormat, pxp_ps_pixel_format_t srcFormat);
+
+/*!
+ * @brief Set the buffers, size and scaler of a scale command.
+ *
+ * Only integer stores to the command, it could be called in interrupt.
+ *
+ * @param cmd The command built by @ref DEMO_PXP_CmdInitScale.
+ * @param destAddr Address of the first output pixel.
+ * @param destPitchBytes Stride of the output in bytes.
+ * @param srcAddr Address of the first PS pixel.
+ * @param srcPitchBytes Stride of the PS in bytes.
+ * @param width Output width in pixel.
+ * @param height Output height in pixel.
+ * @param scaler The scaler configuration.
+ * @param offsetX Horizontal position of the first output pixel in the PS, in 1/4096 decimated pixel.
+ * @param offsetY Vertical position of the first output pixel in the PS, in 1/4096 decimated line.
+ */
+void DEMO_PXP_CmdSetScale(demo_pxp_cmd_t *cmd,
+                          uint32_t destAddr,
+                          uint16_t destPitchBytes,
+                          uint32_t srcAddr,
+                          uint16_t srcPitchBytes,
+                          uint16_t width,
+                          uint16_t height,
+                          const pxp_ps_scaler_config_t *scaler,
+                          uint16_t offsetX,
+                          uint16_t offsetY);
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+#endif /* _PXP_COMMAND_H_ */
@@ -0,0 +1,295 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "pxp_dispatch.h"
+#include "pxp_support.h"
+#include "rotate_support.h"
+#include "fsl_cache.h"
+#include "fsl_debug_console.h"
+#include <string.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Smallest square side measured for the rectangle operations. */
+#define DEMO_PXP_CALIB_MIN_SIDE 8U
+
+/* Times every size is measured, the fastest is used. */
+#define DEMO_PXP_CALIB_REPEAT 4U
+
+/* Initial value of the checksum. */
+#define DEMO_PXP_CALIB_SEED 0x5A5A5A5AU
+
+/* Fill color used in calibration, not a byte pattern so memset could not be used. */
+#define DEMO_PXP_CALIB_COLOR 0xFF3366CCU
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static uint32_t DEMO_PXP_CalibChecksum(const demo_pxp_calib_t *calib);
+static void DEMO_PXP_FillByCpu(void *dest, uint32_t strideBytes, uint8_t bytePerPixel, uint16_t side);
+static uint32_t DEMO_PXP_MeasureRect(
+    demo_pxp_op_t op, bool usePxp, void *dest, const void *src, uint8_t bytePerPixel, uint16_t side);
+static uint32_t DEMO_PXP_UpdateCrossover(uint32_t crossover, uint32_t size, uint32_t cpuCycles, uint32_t pxpCycles);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+/* PXP is used for all sizes until calibrated. */
+static uint32_t s_crossover[kDEMO_PXP_OpCount][DEMO_PXP_CALIB_FORMAT_COUNT];
+static uint32_t s_config;
+
+static const char *const s_opNames[kDEMO_PXP_OpCount] = {"memcopy", "copy rect", "rotate", "fill"};
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static uint32_t DEMO_PXP_CalibChecksum(const demo_pxp_calib_t *calib)
+{
+    const uint32_t *word = (const uint32_t *)(const void *)calib;
+    uint32_t checksum    = DEMO_PXP_CALIB_SEED;
+
+    for (uint32_t i = 0U; i < (offsetof(demo_pxp_calib_t, checksum) / sizeof(uint32_t)); i++)
+    {
+        checksum = ((checksum << 1U) | (checksum >> 31U)) ^ word[i];
+    }
+
+    return checksum;
+}
+
+/* Fill a square as a CPU renderer does, the color is converted once. */
+static void DEMO_PXP_FillByCpu(void *dest, uint32_t strideBytes, uint8_t bytePerPixel, uint16_t side)
+{
+    uint32_t color = DEMO_PXP_CALIB_COLOR;
+
+    for (uint32_t y = 0U; y < side; y++)
+    {
+        uint8_t *line = (uint8_t *)dest + y * strideBytes;
+
+        if (2U == bytePerPixel)
+        {
+            uint16_t color565 = (uint16_t)(((color >> 8U) & 0xF800U) | ((color >> 5U) & 0x07E0U) |
+                                           ((color >> 3U) & 0x001FU));
+
+            for (uint32_t x = 0U; x < side; x++)
+            {
+                ((uint16_t *)(void *)line)[x] = color565;
+            }
+        }
+        else
+        {
+            for (uint32_t x = 0U; x < side; x++)
+            {
+                ((uint32_t *)(void *)line)[x] = color;
+            }
+        }
+    }
+}
+
+/* Process a square at the top left of the buffers, return the CPU cycles until done. */
+static uint32_t DEMO_PXP_MeasureRect(
+    demo_pxp_op_t op, bool usePxp, void *dest, const void *src, uint8_t bytePerPixel, uint16_t side)
+{
+    uint32_t strideBytes = (uint32_t)side * bytePerPixel;
+    uint32_t best        = UINT32_MAX;
+    uint32_t start;
+    uint32_t cycles;
+
+    for (uint32_t i = 0U; i < DEMO_PXP_CALIB_REPEAT; i++)
+    {
+        start = MSDK_GetCpuCycleCount();
+
+        if (kDEMO_PXP_OpCopyRect == op)
+        {
+            if (usePxp)
+            {
+                const demo_pxp_rect_t rect = {.x = 0U, .y = 0U, .width = side, .height = side};
+
+                (void)DEMO_PXP_StartCopyRects(dest, src, strideBytes, bytePerPixel, &rect, 1U);
+                DEMO_PXP_WaitCopy();
+            }
+            else
+            {
+                for (uint32_t y = 0U; y < side; y++)
+                {
+                    (void)memcpy((uint8_t *)dest + y * strideBytes, (const uint8_t *)src + y * strideBytes,
+                                 strideBytes);
+                }
+            }
+        }
+        else if (kDEMO_PXP_OpFill == op)
+        {
+            if (usePxp)
+            {
+                const demo_pxp_rect_t rect = {.x = 0U, .y = 0U, .width = side, .height = side};
+
+                (void)DEMO_PXP_StartFillRects(dest, strideBytes, bytePerPixel, DEMO_PXP_CALIB_COLOR, &rect, 1U);
+                DEMO_PXP_WaitFill();
+            }
+            else
+            {
+                DEMO_PXP_FillByCpu(dest, strideBytes, bytePerPixel, side);
+            }
+        }
+        else
+        {
+            if (usePxp)
+            {
+                const demo_pxp_rotate_rect_t rect = {
+                    .src = {.x = 0U, .y = 0U, .width = side, .height = side}, .destX = 0U, .destY = 0U};
+
+                /* The rendered source is cleaned before PXP reads it, it is part of the cost. */
+#if __CORTEX_M == 4
+                L1CACHE_CleanSystemCacheByRange((uint32_t)src, strideBytes * side);
+#else
+                DCACHE_CleanByRange((uint32_t)src, strideBytes * side);
+#endif
+                (void)DEMO_PXP_StartRotateRects(dest, strideBytes, src, strideBytes, bytePerPixel, kPXP_Rotate270,
+                                                &rect, 1U);
+                DEMO_PXP_WaitRotate();
+            }
+            else
+            {
+                const demo_rotate_image_t srcImage = {
+                    .buffer       = (void *)(uintptr_t)src,
+                    .strideBytes  = strideBytes,
+                    .width        = side,
+                    .height       = side,
+                    .bytePerPixel = bytePerPixel,
+                };
+                const demo_rotate_image_t destImage = {
+                    .buffer       = dest,
+                    .strideBytes  = strideBytes,
+                    .width        = side,
+                    .height       = side,
+                    .bytePerPixel = bytePerPixel,
+                };
+                const demo_rotate_rect_t rect = {.x = 0U, .y = 0U, .width = side, .height = side};
+
+                DEMO_RotateRect(&destImage, &srcImage, &rect, kDEMO_Rotate270);
+            }
+        }
+
+        cycles = MSDK_GetCpuCycleCount() - start;
+        best   = MIN(best, cycles);
+    }
+
+    return best;
+}
+
+/* The crossover is where PXP becomes and stays faster, the sizes are measured in increasing order. */
+static uint32_t DEMO_PXP_UpdateCrossover(uint32_t crossover, uint32_t size, uint32_t cpuCycles, uint32_t pxpCycles)
+{
+    if (pxpCycles >= cpuCycles)
+    {
+        return UINT32_MAX;
+    }
+
+    return (UINT32_MAX == crossover) ? size : crossover;
+}
+
+void DEMO_PXP_Calibrate(void *dest, const void *src, uint32_t bufferSize, uint32_t config)
+{
+    uint32_t crossover;
+    uint32_t cpuCycles;
+    uint32_t pxpCycles;
+
+    MSDK_EnableCpuCycleCounter();
+
+    /* The memory copy has no pixel format. */
+    crossover = DEMO_PXP_BenchmarkMemCopy(dest, src, bufferSize);
+    for (uint32_t format = 0U; format < DEMO_PXP_CALIB_FORMAT_COUNT; format++)
+    {
+        s_crossover[kDEMO_PXP_OpMemCopy][format] = crossover;
+    }
+
+    for (uint32_t format = 0U; format < DEMO_PXP_CALIB_FORMAT_COUNT; format++)
+    {
+        uint8_t bytePerPixel = (0U == format) ? 2U : 4U;
+
+        for (uint32_t op = (uint32_t)kDEMO_PXP_OpCopyRect; op < (uint32_t)kDEMO_PXP_OpCount; op++)
+        {
+            PRINTF("PXP %s calibration, %u byte per pixel, pixels: CPU us, PXP us\r\n", s_opNames[op],
+                   (unsigned int)bytePerPixel);
+
+            crossover = UINT32_MAX;
+
+            for (uint32_t side = DEMO_PXP_CALIB_MIN_SIDE;
+                 (side <= DEMO_PXP_CALIB_MAX_SIDE) && ((side * side * bytePerPixel) <= bufferSize); side *= 2U)
+            {
+                cpuCycles = DEMO_PXP_MeasureRect((demo_pxp_op_t)op, false, dest, src, bytePerPixel, (uint16_t)side);
+                pxpCycles = DEMO_PXP_MeasureRect((demo_pxp_op_t)op, true, dest, src, bytePerPixel, (uint16_t)side);
+
+                PRINTF("%u: %u, %u\r\n", (unsigned int)(side * side),
+                       (unsigned int)COUNT_TO_USEC(cpuCycles, SystemCoreClock),
+                       (unsigned int)COUNT_TO_USEC(pxpCycles, SystemCoreClock));
+
+                crossover = DEMO_PXP_UpdateCrossover(crossover, side * side, cpuCycles, pxpCycles);
+            }
+
+            s_crossover[op][format] = crossover;
+        }
+    }
+
+    s_config = config;
+
+    DEMO_PXP_DumpCalib();
+}
+
+status_t DEMO_PXP_LoadCalib(const demo_pxp_calib_t *calib, uint32_t config)
+{
+    if ((DEMO_PXP_CALIB_VERSION != calib->version) || (config != calib->config) ||
+        (DEMO_PXP_CalibChecksum(calib) != calib->checksum))
+    {
+        return kStatus_Fail;
+    }
+
+    (void)memcpy(s_crossover, calib->crossover, sizeof(s_crossover));
+    s_config = config;
+
+    DEMO_PXP_SetMemCopyThreshold(s_crossover[kDEMO_PXP_OpMemCopy][0]);
+
+    return kStatus_Success;
+}
+
+void DEMO_PXP_GetCalib(demo_pxp_calib_t *calib)
+{
+    (void)memset(calib, 0, sizeof(*calib));
+
+    calib->version = DEMO_PXP_CALIB_VERSION;
+    calib->config  = s_config;
+    (void)memcpy(calib->crossover, s_crossover, sizeof(s_crossover));
+    calib->checksum = DEMO_PXP_CalibChecksum(calib);
+}
+
+void DEMO_PXP_DumpCalib(void)
+{
+    demo_pxp_calib_t calib;
+
+    DEMO_PXP_GetCalib(&calib);
+
+    PRINTF("PXP calibration table:\r\n{%uU, 0x%08xU, {", (unsigned int)calib.version, (unsigned int)calib.config);
+
+    for (uint32_t op = 0U; op < (uint32_t)kDEMO_PXP_OpCount; op++)
+    {
+        PRINTF("%s{%uU, %uU}", (0U == op) ? "" : ", ", (unsigned int)calib.crossover[op][0],
+               (unsigned int)calib.crossover[op][1]);
+    }
+
+    PRINTF("}, 0x%08xU}\r\n", (unsigned int)calib.checksum);
+}
+
+bool DEMO_PXP_IsFaster(demo_pxp_op_t op, uint8_t bytePerPixel, uint32_t size)
+{
+    uint32_t format = (4U == bytePerPixel) ? 1U : 0U;
+
+    assert((uint32_t)op < (uint32_t)kDEMO_PXP_OpCount);
+
+    return size >= s_crossover[op][format];
+}
@@ -0,0 +1,116 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _PXP_DISPATCH_H_
+#define _PXP_DISPATCH_H_
+
+#include "fsl_common.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Version of the calibration table layout, old tables are not loaded. */
+#define DEMO_PXP_CALIB_VERSION 2U
+
+/* Pixel formats in the calibration table, indexed by byte per pixel. */
+#define DEMO_PXP_CALIB_FORMAT_COUNT 2U
+
+/* Largest square side measured for the rectangle operations. */
+#ifndef DEMO_PXP_CALIB_MAX_SIDE
+#define DEMO_PXP_CALIB_MAX_SIDE 512U
+#endif
+
+/*! @brief Operation which could be done by CPU or PXP. */
+typedef enum _demo_pxp_op
+{
+    kDEMO_PXP_OpMemCopy = 0U, /*!< Memory copy, the size is in bytes. */
+    kDEMO_PXP_OpCopyRect,     /*!< Rectangle copy between images, the size is in pixels. */
+    kDEMO_PXP_OpRotate,       /*!< Rectangle rotation by 90 or 270 degree, the size is in pixels. */
+    kDEMO_PXP_OpFill,         /*!< Rectangle solid fill, the size is in pixels. */
+    kDEMO_PXP_OpCount,
+} demo_pxp_op_t;
+
+/*!
+ * @brief CPU and PXP crossover table.
+ *
+ * The table could be saved after calibration and loaded at next boot, it is
+ * only loaded if the version, configuration and checksum match.
+ */
+typedef struct _demo_pxp_calib
+{
+    uint32_t version; /*!< DEMO_PXP_CALIB_VERSION. */
+    uint32_t config;  /*!< Configuration the table is measured in, defined by the application. */
+    /*! Smallest size from which PXP is faster, UINT32_MAX if PXP is never faster.
+        Indexed by operation, and 0 for 2 byte per pixel, 1 for 4 byte per pixel. */
+    uint32_t crossover[kDEMO_PXP_OpCount][DEMO_PXP_CALIB_FORMAT_COUNT];
+    uint32_t checksum; /*!< Checksum of the members above. */
+} demo_pxp_calib_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * @brief Measure every operation on CPU and on PXP, and use the crossover sizes.
+ *
+ * The sizes are doubled every step, the rectangle operations use squares up to
+ * DEMO_PXP_CALIB_MAX_SIDE. The result depends on the memory and its cache
+ * mode, so use the buffers the operations run on later. DEMO_PXP_Init must be
+ * called first, and PXP must be idle.
+ *
+ * @param dest Destination buffer, its content is destroyed.
+ * @param src Source buffer.
+ * @param bufferSize Size of each buffer in bytes.
+ * @param config Configuration saved in the table, such as the clock and cache mode.
+ */
+void DEMO_PXP_Calibrate(void *dest, const void *src, uint32_t bufferSize, uint32_t config);
+
+/*!
+ * @brief Load a calibration table saved before.
+ *
+ * @param calib The table.
+ * @param config Current configuration, the table is only loaded if it is measured in the same one.
+ * @retval kStatus_Success The table is used.
+ * @retval kStatus_Fail The table doesn't match, the current one is kept.
+ */
+status_t DEMO_PXP_LoadCalib(const demo_pxp_calib_t *calib, uint32_t config);
+
+/*!
+ * @brief Get the calibration table in use, to save it.
+ *
+ * @param calib Output table, the checksum is filled.
+ */
+void DEMO_PXP_GetCalib(demo_pxp_calib_t *calib);
+
+/*!
+ * @brief Print the calibration table in use as a C initializer.
+ *
+ * The output could be passed to @ref DEMO_PXP_LoadCalib in later builds.
+ */
+void DEMO_PXP_DumpCalib(void);
+
+/*!
+ * @brief Check whether an operation should be done by PXP.
+ *
+ * Before calibration or loading, PXP is used for all sizes.
+ *
+ * @param op The operation.
+ * @param bytePerPixel 2 or 4, not used by the memory copy.
+ * @param size Bytes of the memory copy, or pixels of the rectangle.
+ * @return true if PXP is faster for this size.
+ */
+bool DEMO_PXP_IsFaster(demo_pxp_op_t op, uint8_t bytePerPixel, uint32_t size);
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+#endif /* _PXP_DISPATCH_H_ */
@@ -0,0 +1,1503 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "pxp_support.h"
+#include "fsl_cache.h"
+#include "fsl_debug_console.h"
+#include <string.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define DEMO_PXP PXP
+
+/* Same with the display controller, so FreeRTOS API could be called in ISR. */
+#define DEMO_PXP_IRQ_PRIORITY 3U
+
+/* The PXP part of a memory copy starts at a cache line. */
+#if defined(FSL_FEATURE_L1DCACHE_LINESIZE_BYTE) && (FSL_FEATURE_L1DCACHE_LINESIZE_BYTE > 0)
+#define DEMO_PXP_CACHE_LINE_BYTES FSL_FEATURE_L1DCACHE_LINESIZE_BYTE
+#else
+#define DEMO_PXP_CACHE_LINE_BYTES 32U
+#endif
+
+/* PXP copies 512 bytes per line as 32-bit pixels. */
+#define DEMO_PXP_MEMCOPY_ALIGN 512U
+
+/* Times every size is measured in the benchmark, the fastest is used. */
+#define DEMO_PXP_BENCHMARK_REPEAT 4U
+
+/* Process surface format to read a 32-bit destination. */
+#if (!(defined(FSL_FEATURE_PXP_HAS_NO_EXTEND_PIXEL_FORMAT) && FSL_FEATURE_PXP_HAS_NO_EXTEND_PIXEL_FORMAT)) && \
+    (!(defined(FSL_FEATURE_PXP_V3) && FSL_FEATURE_PXP_V3))
+#define DEMO_PXP_PS_FORMAT_32BPP kPXP_PsPixelFormatARGB8888
+#else
+#define DEMO_PXP_PS_FORMAT_32BPP kPXP_PsPixelFormatRGB888
+#endif
+
+#if (DEMO_PXP_BLIT_MAX > 32U)
+#error "DEMO_PXP_BLIT_MAX must not be larger than 32"
+#endif
+
+/*! @brief Rectangle list job, the rectangles are copied or rotated one by one. */
+typedef struct _demo_pxp_rect_job
+{
+    demo_pxp_job_t job; /* Must be the first member. */
+    uint32_t destAddr;
+    uint32_t srcAddr;
+    uint16_t destStrideBytes;
+    uint16_t srcStrideBytes;
+    uint8_t bytePerPixel;
+    uint32_t rectCount;
+    /* Index of the next rectangle to start. */
+    uint32_t rectIndex;
+    /* Copied from s_rectCmds, the buffers and size are set for every rectangle. */
+    demo_pxp_cmd_t cmd;
+    demo_pxp_rotate_rect_t rects[DEMO_PXP_COPY_RECT_MAX];
+} demo_pxp_rect_job_t;
+
+/*! @brief Solid fill job, the rectangles are filled one by one. */
+typedef struct _demo_pxp_fill_job
+{
+    demo_pxp_job_t job; /* Must be the first member. */
+    pxp_fill_config_t fillConfig;
+    uint32_t rectCount;
+    /* Index of the next rectangle to start. */
+    uint32_t rectIndex;
+    demo_pxp_rect_t rects[DEMO_PXP_COPY_RECT_MAX];
+} demo_pxp_fill_job_t;
+
+/*! @brief Pattern fill job, the filled part is doubled by every operation. */
+typedef struct _demo_pxp_pattern_job
+{
+    demo_pxp_job_t job; /* Must be the first member. */
+    uint32_t destAddr;
+    uint16_t destStrideBytes;
+    uint32_t patternAddr;
+    uint16_t patternStrideBytes;
+    pxp_as_pixel_format_t pixelFormat;
+    demo_pxp_rect_t rect;
+    /* Pattern size clipped by the rectangle. */
+    uint16_t tileWidth;
+    uint16_t tileHeight;
+    /* Part filled at the top left of the rectangle, 0 before the first tile. */
+    uint16_t filledWidth;
+    uint16_t filledHeight;
+} demo_pxp_pattern_job_t;
+
+/*! @brief Scale job, the output tiles are scaled one by one. */
+typedef struct _demo_pxp_scale_job
+{
+    demo_pxp_job_t job; /* Must be the first member. */
+    uint32_t destAddr;
+    uint16_t destStrideBytes;
+    uint32_t srcAddr;
+    uint16_t srcStrideBytes;
+    uint8_t bytePerPixel;
+    demo_pxp_rect_t area;
+    pxp_ps_scaler_config_t scaler;
+    /* Top left of the next tile in the area. */
+    uint16_t tileX;
+    uint16_t tileY;
+    /* The buffers, size and source offset are set for every tile. */
+    demo_pxp_cmd_t cmd;
+} demo_pxp_scale_job_t;
+
+/*! @brief Scaler configuration cache entry. */
+typedef struct _demo_pxp_scaler_entry
+{
+    uint16_t inputWidth;
+    uint16_t inputHeight;
+    uint16_t outputWidth;
+    uint16_t outputHeight;
+    /* Value of s_scalerUseCount when last used, 0 if the entry is empty. */
+    uint32_t lastUse;
+    pxp_ps_scaler_config_t config;
+} demo_pxp_scaler_entry_t;
+
+/*! @brief Palette cache entry, the palette converted to the destination pixel format. */
+typedef struct _demo_pxp_palette_entry
+{
+    const uint32_t *palette;
+    uint16_t paletteSize;
+    uint8_t bytePerPixel;
+    /* Value of s_paletteUseCount when last used, 0 if the entry is empty. */
+    uint32_t lastUse;
+    union
+    {
+        uint16_t rgb565[256];
+        uint32_t xrgb8888[256];
+    } table;
+} demo_pxp_palette_entry_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static bool DEMO_PXP_FinishJob(demo_pxp_job_t *job, bool inIsr);
+static demo_pxp_job_t *DEMO_PXP_RunQueue(void);
+static void DEMO_PXP_FinishJobs(demo_pxp_job_t *job);
+#if DEMO_PXP_SHARE_LVGL
+static void DEMO_PXP_SharedIRQHandler(void);
+#endif
+static bool DEMO_PXP_RunRectJob(demo_pxp_job_t *job);
+static bool DEMO_PXP_RunFillJob(demo_pxp_job_t *job);
+static bool DEMO_PXP_RunPatternJob(demo_pxp_job_t *job);
+static bool DEMO_PXP_RunMemCopy(demo_pxp_job_t *job);
+static bool DEMO_PXP_RunScaleJob(demo_pxp_job_t *job);
+static void DEMO_PXP_GetScalerConfig(uint16_t inputWidth,
+                                     uint16_t inputHeight,
+                                     uint16_t outputWidth,
+                                     uint16_t outputHeight,
+                                     pxp_ps_scaler_config_t *config);
+static const demo_pxp_palette_entry_t *DEMO_PXP_GetPalette(const uint32_t *palette,
+                                                           uint16_t paletteSize,
+                                                           uint8_t bytePerPixel);
+static bool DEMO_PXP_RunBlitBatch(demo_pxp_job_t *job);
+static bool DEMO_PXP_IsSameBlitConfig(const demo_pxp_blit_t *blit1, const demo_pxp_blit_t *blit2);
+static bool DEMO_PXP_IsBlitOverlapped(const demo_pxp_blit_t *blit1, const demo_pxp_blit_t *blit2);
+static void DEMO_PXP_SortBlits(demo_pxp_blit_t *blits, uint32_t blitCount);
+static void DEMO_PXP_GetBlitConfig(const demo_pxp_blit_t *blit, pxp_porter_duff_config_t *config);
+static void DEMO_PXP_CleanCache(uint32_t addr, uint32_t size);
+static void DEMO_PXP_InvalidateCache(uint32_t addr, uint32_t size);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+/* Job queue, the head job is running if s_jobStarted. */
+static demo_pxp_job_t *s_jobHead;
+static demo_pxp_job_t *s_jobTail;
+static volatile bool s_jobStarted;
+
+/* Locked by other software, no job is started. */
+static volatile bool s_locked;
+#if defined(SDK_OS_FREE_RTOS)
+/* Released when the running job is done while locked. */
+static SemaphoreHandle_t s_jobIdle;
+#endif
+
+#if DEMO_PXP_SHARE_LVGL
+/* The handler installed in the vector table before, the LVGL one. */
+static void (*s_lvglIRQHandler)(void);
+#endif
+
+static demo_pxp_rect_job_t s_copyJob;
+static demo_pxp_rect_job_t s_rotateJob;
+static demo_pxp_fill_job_t s_fillJob;
+static demo_pxp_pattern_job_t s_patternJob;
+static demo_pxp_scale_job_t s_scaleJob;
+
+static demo_pxp_scaler_entry_t s_scalerCache[DEMO_PXP_SCALER_CACHE_SIZE];
+static uint32_t s_scalerUseCount;
+
+static demo_pxp_palette_entry_t s_paletteCache[DEMO_PXP_PALETTE_CACHE_SIZE];
+static uint32_t s_paletteUseCount;
+
+static uint32_t s_memCopyMinBytes = DEMO_PXP_MEMCOPY_MIN_BYTES;
+
+/* Rectangle copy and rotation commands, indexed by 2 or 4 byte per pixel, then by degree. */
+static const demo_pxp_cmd_t s_rectCmds[2][4] = {
+    {
+        DEMO_PXP_CMD_RECT_INIT(kPXP_AsPixelFormatRGB565, kPXP_Rotate0),
+        DEMO_PXP_CMD_RECT_INIT(kPXP_AsPixelFormatRGB565, kPXP_Rotate90),
+        DEMO_PXP_CMD_RECT_INIT(kPXP_AsPixelFormatRGB565, kPXP_Rotate180),
+        DEMO_PXP_CMD_RECT_INIT(kPXP_AsPixelFormatRGB565, kPXP_Rotate270),
+    },
+    {
+        DEMO_PXP_CMD_RECT_INIT(kPXP_AsPixelFormatARGB8888, kPXP_Rotate0),
+        DEMO_PXP_CMD_RECT_INIT(kPXP_AsPixelFormatARGB8888, kPXP_Rotate90),
+        DEMO_PXP_CMD_RECT_INIT(kPXP_AsPixelFormatARGB8888, kPXP_Rotate180),
+        DEMO_PXP_CMD_RECT_INIT(kPXP_AsPixelFormatARGB8888, kPXP_Rotate270),
+    },
+};
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+/* Release the job, return true if a higher priority task is woken. */
+static bool DEMO_PXP_FinishJob(demo_pxp_job_t *job, bool inIsr)
+{
+    bool taskAwake = false;
+
+    job->busy = false;
+
+    if (NULL != job->callback)
+    {
+        job->callback(job, job->param);
+    }
+
+#if defined(SDK_OS_FREE_RTOS)
+    if (inIsr)
+    {
+        BaseType_t awake = pdFALSE;
+
+        (void)xSemaphoreGiveFromISR(job->done, &awake);
+        taskAwake = (pdFALSE != awake);
+    }
+    else
+    {
+        (void)xSemaphoreGive(job->done);
+    }
+#else
+    (void)inIsr;
+#endif
+
+    return taskAwake;
+}
+
+/*
+ * Continue the running job, when it is finished, start the next queued one,
+ * until an operation is started. Called with the PXP interrupt disabled.
+ * Return the finished jobs, linked by next.
+ */
+static demo_pxp_job_t *DEMO_PXP_RunQueue(void)
+{
+    demo_pxp_job_t *finished = NULL;
+    demo_pxp_job_t *finishedTail = NULL;
+    demo_pxp_job_t *job;
+
+    while (NULL != s_jobHead)
+    {
+        job = s_jobHead;
+
+        /* No new job while locked. */
+        if ((!s_jobStarted) && s_locked)
+        {
+            break;
+        }
+
+        if (job->run(job))
+        {
+            s_jobStarted = true;
+            break;
+        }
+
+        s_jobHead    = job->next;
+        s_jobStarted = false;
+
+        job->next = NULL;
+        if (NULL == finished)
+        {
+            finished = job;
+        }
+        else
+        {
+            finishedTail->next = job;
+        }
+        finishedTail = job;
+    }
+
+    return finished;
+}
+
+/* Finish the jobs returned by DEMO_PXP_RunQueue, not in interrupt. */
+static void DEMO_PXP_FinishJobs(demo_pxp_job_t *job)
+{
+    demo_pxp_job_t *next;
+
+    while (NULL != job)
+    {
+        /* The job could be submitted again once it is finished. */
+        next = job->next;
+        (void)DEMO_PXP_FinishJob(job, false);
+        job = next;
+    }
+}
+
+static bool DEMO_PXP_RunRectJob(demo_pxp_job_t *job)
+{
+    demo_pxp_rect_job_t *rectJob = (demo_pxp_rect_job_t *)job;
+    const demo_pxp_rotate_rect_t *rect;
+    uint32_t srcAddr;
+    uint32_t destAddr;
+
+    if (rectJob->rectIndex >= rectJob->rectCount)
+    {
+        return false;
+    }
+
+    rect = &rectJob->rects[rectJob->rectIndex];
+    rectJob->rectIndex++;
+
+    srcAddr = rectJob->srcAddr + (uint32_t)rect->src.y * rectJob->srcStrideBytes +
+              (uint32_t)rect->src.x * rectJob->bytePerPixel;
+    destAddr = rectJob->destAddr + (uint32_t)rect->destY * rectJob->destStrideBytes +
+               (uint32_t)rect->destX * rectJob->bytePerPixel;
+
+    /* The output size is the size before rotation. */
+    DEMO_PXP_CmdSetRect(&rectJob->cmd, destAddr, rectJob->destStrideBytes, srcAddr, rectJob->srcStrideBytes,
+                        rect->src.width, rect->src.height);
+
+    DEMO_PXP_StartCommand(&rectJob->cmd);
+
+    return true;
+}
+
+static bool DEMO_PXP_RunFillJob(demo_pxp_job_t *job)
+{
+    demo_pxp_fill_job_t *fillJob = (demo_pxp_fill_job_t *)job;
+    const demo_pxp_rect_t *rect;
+
+    if (fillJob->rectIndex >= fillJob->rectCount)
+    {
+        return false;
+    }
+
+    rect = &fillJob->rects[fillJob->rectIndex];
+    fillJob->rectIndex++;
+
+    fillJob->fillConfig.destOffsetX = rect->x;
+    fillJob->fillConfig.destOffsetY = rect->y;
+    fillJob->fillConfig.width       = rect->width;
+    fillJob->fillConfig.height      = rect->height;
+
+    (void)PXP_StartFill(DEMO_PXP, &fillJob->fillConfig);
+
+    return true;
+}
+
+static bool DEMO_PXP_RunPatternJob(demo_pxp_job_t *job)
+{
+    demo_pxp_pattern_job_t *patternJob = (demo_pxp_pattern_job_t *)job;
+    const demo_pxp_rect_t *rect        = &patternJob->rect;
+
+    /* By default the filled part is copied to the same place, the branches below move it. */
+    pxp_pic_copy_config_t copyConfig = {
+        .srcPicBaseAddr  = patternJob->destAddr,
+        .srcPitchBytes   = patternJob->destStrideBytes,
+        .srcOffsetX      = rect->x,
+        .srcOffsetY      = rect->y,
+        .destPicBaseAddr = patternJob->destAddr,
+        .destPitchBytes  = patternJob->destStrideBytes,
+        .destOffsetX     = rect->x,
+        .destOffsetY     = rect->y,
+        .pixelFormat     = patternJob->pixelFormat,
+    };
+
+    if (0U == patternJob->filledWidth)
+    {
+        /* The first tile comes from the pattern. */
+        copyConfig.srcPicBaseAddr = patternJob->patternAddr;
+        copyConfig.srcPitchBytes  = patternJob->patternStrideBytes;
+        copyConfig.srcOffsetX     = 0U;
+        copyConfig.srcOffsetY     = 0U;
+        copyConfig.width          = patternJob->tileWidth;
+        copyConfig.height         = patternJob->tileHeight;
+
+        patternJob->filledWidth  = patternJob->tileWidth;
+        patternJob->filledHeight = patternJob->tileHeight;
+    }
+    else if (patternJob->filledWidth < rect->width)
+    {
+        /* Double the width of the first tile row. */
+        copyConfig.destOffsetX = rect->x + patternJob->filledWidth;
+        copyConfig.width       = MIN(patternJob->filledWidth, rect->width - patternJob->filledWidth);
+        copyConfig.height      = patternJob->filledHeight;
+
+        patternJob->filledWidth += copyConfig.width;
+    }
+    else if (patternJob->filledHeight < rect->height)
+    {
+        /* Double the height with full width rows. */
+        copyConfig.destOffsetY = rect->y + patternJob->filledHeight;
+        copyConfig.width       = rect->width;
+        copyConfig.height      = MIN(patternJob->filledHeight, rect->height - patternJob->filledHeight);
+
+        patternJob->filledHeight += copyConfig.height;
+    }
+    else
+    {
+        return false;
+    }
+
+    (void)PXP_StartPictureCopy(DEMO_PXP, &copyConfig);
+
+    return true;
+}
+
+static bool DEMO_PXP_RunMemCopy(demo_pxp_job_t *job)
+{
+    demo_pxp_memcopy_t *handle = (demo_pxp_memcopy_t *)job;
+    uint32_t chunkSize;
+
+    if (0U == handle->size)
+    {
+        return false;
+    }
+
+    chunkSize = MIN(handle->size, DEMO_PXP_MEMCOPY_CHUNK_BYTES);
+
+    /* The interrupt enable is kept by the driver. */
+    (void)PXP_StartMemCopy(DEMO_PXP, handle->srcAddr, handle->destAddr, chunkSize);
+
+    handle->srcAddr += chunkSize;
+    handle->destAddr += chunkSize;
+    handle->size -= chunkSize;
+
+    return true;
+}
+
+static bool DEMO_PXP_RunScaleJob(demo_pxp_job_t *job)
+{
+    demo_pxp_scale_job_t *scaleJob = (demo_pxp_scale_job_t *)job;
+    const demo_pxp_rect_t *area    = &scaleJob->area;
+    uint16_t width;
+    uint16_t height;
+    uint32_t srcX;
+    uint32_t srcY;
+    uint32_t destAddr;
+    uint32_t srcAddr;
+
+    if (scaleJob->tileY >= area->height)
+    {
+        return false;
+    }
+
+    width  = (uint16_t)MIN((uint32_t)area->width - scaleJob->tileX, DEMO_PXP_SCALE_TILE_MAX);
+    height = (uint16_t)MIN((uint32_t)area->height - scaleJob->tileY, DEMO_PXP_SCALE_TILE_MAX);
+
+    /* Source position of the tile, in 1/4096 decimated pixel. */
+    srcX = (uint32_t)scaleJob->tileX * scaleJob->scaler.scaleX;
+    srcY = (uint32_t)scaleJob->tileY * scaleJob->scaler.scaleY;
+
+    destAddr = scaleJob->destAddr + ((uint32_t)area->y + scaleJob->tileY) * scaleJob->destStrideBytes +
+               ((uint32_t)area->x + scaleJob->tileX) * scaleJob->bytePerPixel;
+    srcAddr  = scaleJob->srcAddr + ((srcY >> 12U) << scaleJob->scaler.decY) * scaleJob->srcStrideBytes +
+               ((srcX >> 12U) << scaleJob->scaler.decX) * scaleJob->bytePerPixel;
+
+    DEMO_PXP_CmdSetScale(&scaleJob->cmd, destAddr, scaleJob->destStrideBytes, srcAddr, scaleJob->srcStrideBytes,
+                         width, height, &scaleJob->scaler, (uint16_t)(srcX & 0xFFFU), (uint16_t)(srcY & 0xFFFU));
+
+    scaleJob->tileX += width;
+
+    if (scaleJob->tileX >= area->width)
+    {
+        scaleJob->tileX = 0U;
+        scaleJob->tileY += height;
+    }
+
+    DEMO_PXP_StartCommand(&scaleJob->cmd);
+
+    return true;
+}
+
+static void DEMO_PXP_GetScalerConfig(uint16_t inputWidth,
+                                     uint16_t inputHeight,
+                                     uint16_t outputWidth,
+                                     uint16_t outputHeight,
+                                     pxp_ps_scaler_config_t *config)
+{
+    demo_pxp_scaler_entry_t *entry = &s_scalerCache[0];
+
+    s_scalerUseCount++;
+
+    for (uint32_t i = 0U; i < DEMO_PXP_SCALER_CACHE_SIZE; i++)
+    {
+        if ((0U != s_scalerCache[i].lastUse) && (inputWidth == s_scalerCache[i].inputWidth) &&
+            (inputHeight == s_scalerCache[i].inputHeight) && (outputWidth == s_scalerCache[i].outputWidth) &&
+            (outputHeight == s_scalerCache[i].outputHeight))
+        {
+            s_scalerCache[i].lastUse = s_scalerUseCount;
+            *config                  = s_scalerCache[i].config;
+            return;
+        }
+
+        /* Empty entry has the smallest lastUse, it is replaced first. */
+        if (s_scalerCache[i].lastUse < entry->lastUse)
+        {
+            entry = &s_scalerCache[i];
+        }
+    }
+
+    PXP_GetProcessSurfaceScalerConfig(inputWidth, inputHeight, outputWidth, outputHeight, &entry->config);
+
+    entry->inputWidth   = inputWidth;
+    entry->inputHeight  = inputHeight;
+    entry->outputWidth  = outputWidth;
+    entry->outputHeight = outputHeight;
+    entry->lastUse      = s_scalerUseCount;
+    *config             = entry->config;
+}
+
+static const demo_pxp_palette_entry_t *DEMO_PXP_GetPalette(const uint32_t *palette,
+                                                           uint16_t paletteSize,
+                                                           uint8_t bytePerPixel)
+{
+    demo_pxp_palette_entry_t *entry = &s_paletteCache[0];
+    uint32_t color;
+
+    s_paletteUseCount++;
+
+    for (uint32_t i = 0U; i < DEMO_PXP_PALETTE_CACHE_SIZE; i++)
+    {
+        if ((0U != s_paletteCache[i].lastUse) && (palette == s_paletteCache[i].palette) &&
+            (paletteSize == s_paletteCache[i].paletteSize) && (bytePerPixel == s_paletteCache[i].bytePerPixel))
+        {
+            s_paletteCache[i].lastUse = s_paletteUseCount;
+            return &s_paletteCache[i];
+        }
+
+        /* Empty entry has the smallest lastUse, it is replaced first. */
+        if (s_paletteCache[i].lastUse < entry->lastUse)
+        {
+            entry = &s_paletteCache[i];
+        }
+    }
+
+    /* Indexes out of the palette are black. */
+    (void)memset(&entry->table, 0, sizeof(entry->table));
+
+    for (uint32_t i = 0U; i < paletteSize; i++)
+    {
+        color = palette[i];
+
+        if (4U == bytePerPixel)
+        {
+            entry->table.xrgb8888[i] = color | 0xFF000000U;
+        }
+        else
+        {
+            entry->table.rgb565[i] =
+                (uint16_t)(((color >> 8U) & 0xF800U) | ((color >> 5U) & 0x07E0U) | ((color >> 3U) & 0x001FU));
+        }
+    }
+
+    entry->palette      = palette;
+    entry->paletteSize  = paletteSize;
+    entry->bytePerPixel = bytePerPixel;
+    entry->lastUse      = s_paletteUseCount;
+
+    return entry;
+}
+
+static bool DEMO_PXP_RunBlitBatch(demo_pxp_job_t *job)
+{
+    demo_pxp_blit_batch_t *batch = (demo_pxp_blit_batch_t *)job;
+    uint32_t index               = batch->blitIndex;
+
+    if (0U == index)
+    {
+        batch->startCycle = MSDK_GetCpuCycleCount();
+    }
+
+    if (index >= batch->stat.blitCount)
+    {
+        /* The other jobs' commands don't set the Porter-Duff configuration. */
+        const pxp_porter_duff_config_t pdDisable = {0};
+
+        PXP_SetPorterDuffConfig(DEMO_PXP, &pdDisable);
+
+        batch->stat.cycles = MSDK_GetCpuCycleCount() - batch->startCycle;
+
+        return false;
+    }
+
+    if (0U != (batch->reconfigMask & (1UL << index)))
+    {
+        PXP_SetPorterDuffConfig(DEMO_PXP, &batch->pdConfigs[index]);
+    }
+
+    batch->blitIndex++;
+
+    DEMO_PXP_StartCommand(&batch->cmds[index]);
+
+    return true;
+}
+
+static bool DEMO_PXP_IsSameBlitConfig(const demo_pxp_blit_t *blit1, const demo_pxp_blit_t *blit2)
+{
+    return (blit1->srcFormat == blit2->srcFormat) && (blit1->opa == blit2->opa) && (blit1->mode == blit2->mode);
+}
+
+static bool DEMO_PXP_IsBlitOverlapped(const demo_pxp_blit_t *blit1, const demo_pxp_blit_t *blit2)
+{
+    const demo_pxp_rect_t *area1 = &blit1->area;
+    const demo_pxp_rect_t *area2 = &blit2->area;
+
+    /* Different destination images never overlap. */
+    if ((blit1->dest != blit2->dest) || (blit1->destStrideBytes != blit2->destStrideBytes))
+    {
+        return false;
+    }
+
+    return ((uint32_t)area1->x < ((uint32_t)area2->x + area2->width)) &&
+           ((uint32_t)area2->x < ((uint32_t)area1->x + area1->width)) &&
+           ((uint32_t)area1->y < ((uint32_t)area2->y + area2->height)) &&
+           ((uint32_t)area2->y < ((uint32_t)area1->y + area1->height));
+}
+
+/* Move every blit back after the last one with the same configuration, unless it overlaps a blit it passes. */
+static void DEMO_PXP_SortBlits(demo_pxp_blit_t *blits, uint32_t blitCount)
+{
+    demo_pxp_blit_t blit;
+    uint32_t pos;
+
+    for (uint32_t i = 1U; i < blitCount; i++)
+    {
+        pos = i;
+
+        for (uint32_t j = i; j > 0U; j--)
+        {
+            if (DEMO_PXP_IsSameBlitConfig(&blits[j - 1U], &blits[i]))
+            {
+                pos = j;
+                break;
+            }
+
+            if (DEMO_PXP_IsBlitOverlapped(&blits[j - 1U], &blits[i]))
+            {
+                break;
+            }
+        }
+
+        if (pos < i)
+        {
+            blit = blits[i];
+            (void)memmove(&blits[pos + 1U], &blits[pos], (i - pos) * sizeof(demo_pxp_blit_t));
+            blits[pos] = blit;
+        }
+    }
+}
+
+static void DEMO_PXP_GetBlitConfig(const demo_pxp_blit_t *blit, pxp_porter_duff_config_t *config)
+{
+    uint8_t srcGlobalAlphaMode;
+
+    /* Source without alpha uses the opacity as alpha, source with alpha is scaled by the opacity. */
+    if (kPXP_AsPixelFormatARGB8888 != blit->srcFormat)
+    {
+        srcGlobalAlphaMode = (uint8_t)kPXP_PorterDuffGlobalAlpha;
+    }
+    else if (0xFFU == blit->opa)
+    {
+        srcGlobalAlphaMode = (uint8_t)kPXP_PorterDuffLocalAlpha;
+    }
+    else
+    {
+        srcGlobalAlphaMode = (uint8_t)kPXP_PorterDuffScaledAlpha;
+    }
+
+    /* The destination has no alpha, it is opaque. */
+    (void)PXP_GetPorterDuffConfigExt(blit->mode, config, (uint8_t)kPXP_PorterDuffGlobalAlpha,
+                                     (uint8_t)kPXP_PorterDuffAlphaStraight, (uint8_t)kPXP_PorterDuffColorWithAlpha,
+                                     srcGlobalAlphaMode, (uint8_t)kPXP_PorterDuffAlphaStraight,
+                                     (uint8_t)kPXP_PorterDuffColorWithAlpha, 0xFFU, blit->opa);
+}
+
+static void DEMO_PXP_CleanCache(uint32_t addr, uint32_t size)
+{
+#if __CORTEX_M == 4
+    L1CACHE_CleanSystemCacheByRange(addr, size);
+#else
+    DCACHE_CleanByRange(addr, size);
+#endif
+}
+
+static void DEMO_PXP_InvalidateCache(uint32_t addr, uint32_t size)
+{
+#if __CORTEX_M == 4
+    L1CACHE_InvalidateSystemCacheByRange(addr, size);
+#else
+    DCACHE_InvalidateByRange(addr, size);
+#endif
+}
+
+void DEMO_PXP_StartCommand(const demo_pxp_cmd_t *cmd)
+{
+    /* PXP loads the command from memory. */
+    DEMO_PXP_CleanCache((uint32_t)cmd, sizeof(demo_pxp_cmd_t));
+
+    PXP_SetNextCommand(DEMO_PXP, (void *)(uintptr_t)cmd);
+}
+
+void DEMO_PXP_IRQHandler(void)
+{
+    demo_pxp_job_t *job;
+    demo_pxp_job_t *next;
+    bool taskAwake = false;
+
+    if (0U == (PXP_GetStatusFlags(DEMO_PXP) & (uint32_t)kPXP_CompleteFlag))
+    {
+        return;
+    }
+
+    PXP_ClearStatusFlags(DEMO_PXP, (uint32_t)kPXP_CompleteFlag);
+
+    job = DEMO_PXP_RunQueue();
+
+    while (NULL != job)
+    {
+        next = job->next;
+
+        if (DEMO_PXP_FinishJob(job, true))
+        {
+            taskAwake = true;
+        }
+
+        job = next;
+    }
+
+#if defined(SDK_OS_FREE_RTOS)
+    if (s_locked && (!s_jobStarted))
+    {
+        BaseType_t awake = pdFALSE;
+
+        (void)xSemaphoreGiveFromISR(s_jobIdle, &awake);
+        taskAwake = taskAwake || (pdFALSE != awake);
+    }
+
+    portYIELD_FROM_ISR(taskAwake ? pdTRUE : pdFALSE);
+#else
+    (void)taskAwake;
+#endif
+}
+
+#if DEMO_PXP_HANDLE_IRQ
+void PXP_IRQHandler(void)
+{
+    DEMO_PXP_IRQHandler();
+    SDK_ISR_EXIT_BARRIER;
+}
+#endif
+
+#if DEMO_PXP_SHARE_LVGL
+/* Installed in the vector table, the PXP is used by the queue or by LVGL, never both. */
+static void DEMO_PXP_SharedIRQHandler(void)
+{
+    if (s_jobStarted)
+    {
+        DEMO_PXP_IRQHandler();
+    }
+    else
+    {
+        s_lvglIRQHandler();
+    }
+
+    SDK_ISR_EXIT_BARRIER;
+}
+#endif
+
+status_t DEMO_PXP_Init(void)
+{
+    s_jobHead    = NULL;
+    s_jobTail    = NULL;
+    s_jobStarted = false;
+    s_locked     = false;
+
+#if defined(SDK_OS_FREE_RTOS)
+    if (NULL == s_jobIdle)
+    {
+        s_jobIdle = xSemaphoreCreateBinary();
+        if (NULL == s_jobIdle)
+        {
+            return kStatus_Fail;
+        }
+    }
+#endif
+
+    if ((kStatus_Success != DEMO_PXP_InitJob(&s_copyJob.job, DEMO_PXP_RunRectJob, NULL, NULL)) ||
+        (kStatus_Success != DEMO_PXP_InitJob(&s_rotateJob.job, DEMO_PXP_RunRectJob, NULL, NULL)) ||
+        (kStatus_Success != DEMO_PXP_InitJob(&s_fillJob.job, DEMO_PXP_RunFillJob, NULL, NULL)) ||
+        (kStatus_Success != DEMO_PXP_InitJob(&s_patternJob.job, DEMO_PXP_RunPatternJob, NULL, NULL)) ||
+        (kStatus_Success != DEMO_PXP_InitJob(&s_scaleJob.job, DEMO_PXP_RunScaleJob, NULL, NULL)))
+    {
+        return kStatus_Fail;
+    }
+
+    PXP_Init(DEMO_PXP);
+    PXP_EnableInterrupts(DEMO_PXP, (uint32_t)kPXP_CompleteInterruptEnable);
+
+#if DEMO_PXP_SHARE_LVGL
+    s_lvglIRQHandler = (void (*)(void))InstallIRQHandler(PXP_IRQn, (uint32_t)DEMO_PXP_SharedIRQHandler);
+#endif
+
+#if DEMO_PXP_HANDLE_IRQ || DEMO_PXP_SHARE_LVGL
+    NVIC_ClearPendingIRQ(PXP_IRQn);
+    NVIC_SetPriority(PXP_IRQn, DEMO_PXP_IRQ_PRIORITY);
+    EnableIRQ(PXP_IRQn);
+#endif
+
+    return kStatus_Success;
+}
+
+status_t DEMO_PXP_InitJob(demo_pxp_job_t *job, demo_pxp_job_run_t run, demo_pxp_job_callback_t callback, void *param)
+{
+    assert(NULL != run);
+
+    job->run      = run;
+    job->callback = callback;
+    job->param    = param;
+    job->next     = NULL;
+    job->busy     = false;
+
+#if defined(SDK_OS_FREE_RTOS)
+    job->done = xSemaphoreCreateBinary();
+    if (NULL == job->done)
+    {
+        return kStatus_Fail;
+    }
+#endif
+
+    return kStatus_Success;
+}
+
+void DEMO_PXP_SubmitJob(demo_pxp_job_t *job)
+{
+    uint32_t regPrimask;
+    demo_pxp_job_t *finished = NULL;
+
+    assert(!job->busy);
+
+    job->next = NULL;
+    job->busy = true;
+
+    /* The queue is shared with the PXP interrupt. */
+    regPrimask = DisableGlobalIRQ();
+
+    if (NULL == s_jobHead)
+    {
+        s_jobHead = job;
+    }
+    else
+    {
+        s_jobTail->next = job;
+    }
+    s_jobTail = job;
+
+    /* Otherwise it is started in the PXP interrupt, or when unlocked. */
+    if (!s_jobStarted)
+    {
+        finished = DEMO_PXP_RunQueue();
+    }
+
+    EnableGlobalIRQ(regPrimask);
+
+    DEMO_PXP_FinishJobs(finished);
+}
+
+bool DEMO_PXP_IsJobDone(const demo_pxp_job_t *job)
+{
+    return !job->busy;
+}
+
+void DEMO_PXP_WaitJob(demo_pxp_job_t *job)
+{
+    /* The semaphore might be released by an earlier run of the job, so check the flag again. */
+    while (job->busy)
+    {
+#if defined(SDK_OS_FREE_RTOS)
+        (void)xSemaphoreTake(job->done, portMAX_DELAY);
+#endif
+    }
+}
+
+void DEMO_PXP_Lock(void)
+{
+    uint32_t regPrimask;
+
+    regPrimask = DisableGlobalIRQ();
+    s_locked   = true;
+    EnableGlobalIRQ(regPrimask);
+
+    /* The semaphore might be released by an earlier lock, so check the flag again. */
+    while (s_jobStarted)
+    {
+#if defined(SDK_OS_FREE_RTOS)
+        (void)xSemaphoreTake(s_jobIdle, portMAX_DELAY);
+#endif
+    }
+}
+
+void DEMO_PXP_Unlock(void)
+{
+    /* The other jobs' commands don't set the Porter-Duff configuration. */
+    const pxp_porter_duff_config_t pdDisable = {0};
+    uint32_t regPrimask;
+    demo_pxp_job_t *finished;
+
+    if (!s_locked)
+    {
+        return;
+    }
+
+#if PXP_USE_SHADOW_REGISTER
+    /* The lock owner might have written the registers directly. */
+    PXP_InvalidateShadow(DEMO_PXP);
+#endif
+    PXP_SetPorterDuffConfig(DEMO_PXP, &pdDisable);
+    PXP_EnableInterrupts(DEMO_PXP, (uint32_t)kPXP_CompleteInterruptEnable);
+
+    regPrimask = DisableGlobalIRQ();
+    s_locked   = false;
+    finished   = DEMO_PXP_RunQueue();
+    EnableGlobalIRQ(regPrimask);
+
+    DEMO_PXP_FinishJobs(finished);
+}
+
+status_t DEMO_PXP_StartCopyRects(void *dest,
+                                 const void *src,
+                                 uint32_t strideBytes,
+                                 uint8_t bytePerPixel,
+                                 const demo_pxp_rect_t *rects,
+                                 uint32_t rectCount)
+{
+    if ((rectCount > DEMO_PXP_COPY_RECT_MAX) || ((bytePerPixel != 2U) && (bytePerPixel != 4U)))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    DEMO_PXP_WaitCopy();
+
+    if (0U == rectCount)
+    {
+        return kStatus_Success;
+    }
+
+    s_copyJob.destAddr        = (uint32_t)dest;
+    s_copyJob.srcAddr         = (uint32_t)src;
+    s_copyJob.destStrideBytes = (uint16_t)strideBytes;
+    s_copyJob.srcStrideBytes  = (uint16_t)strideBytes;
+    s_copyJob.bytePerPixel    = bytePerPixel;
+    s_copyJob.rectCount       = rectCount;
+    s_copyJob.rectIndex       = 0U;
+    s_copyJob.cmd             = s_rectCmds[bytePerPixel / 4U][kPXP_Rotate0];
+
+    for (uint32_t i = 0U; i < rectCount; i++)
+    {
+        s_copyJob.rects[i].src   = rects[i];
+        s_copyJob.rects[i].destX = rects[i].x;
+        s_copyJob.rects[i].destY = rects[i].y;
+    }
+
+    DEMO_PXP_SubmitJob(&s_copyJob.job);
+
+    return kStatus_Success;
+}
+
+bool DEMO_PXP_IsCopyDone(void)
+{
+    return DEMO_PXP_IsJobDone(&s_copyJob.job);
+}
+
+void DEMO_PXP_WaitCopy(void)
+{
+    DEMO_PXP_WaitJob(&s_copyJob.job);
+}
+
+status_t DEMO_PXP_StartRotateRects(void *dest,
+                                   uint32_t destStrideBytes,
+                                   const void *src,
+                                   uint32_t srcStrideBytes,
+                                   uint8_t bytePerPixel,
+                                   pxp_rotate_degree_t degree,
+                                   const demo_pxp_rotate_rect_t *rects,
+                                   uint32_t rectCount)
+{
+    if ((rectCount > DEMO_PXP_COPY_RECT_MAX) || ((bytePerPixel != 2U) && (bytePerPixel != 4U)))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    DEMO_PXP_WaitRotate();
+
+    if (0U == rectCount)
+    {
+        return kStatus_Success;
+    }
+
+    s_rotateJob.destAddr        = (uint32_t)dest;
+    s_rotateJob.srcAddr         = (uint32_t)src;
+    s_rotateJob.destStrideBytes = (uint16_t)destStrideBytes;
+    s_rotateJob.srcStrideBytes  = (uint16_t)srcStrideBytes;
+    s_rotateJob.bytePerPixel    = bytePerPixel;
+    s_rotateJob.rectCount       = rectCount;
+    s_rotateJob.rectIndex       = 0U;
+    s_rotateJob.cmd             = s_rectCmds[bytePerPixel / 4U][degree];
+    (void)memcpy(s_rotateJob.rects, rects, rectCount * sizeof(demo_pxp_rotate_rect_t));
+
+    DEMO_PXP_SubmitJob(&s_rotateJob.job);
+
+    return kStatus_Success;
+}
+
+bool DEMO_PXP_IsRotateDone(void)
+{
+    return DEMO_PXP_IsJobDone(&s_rotateJob.job);
+}
+
+void DEMO_PXP_WaitRotate(void)
+{
+    DEMO_PXP_WaitJob(&s_rotateJob.job);
+}
+
+status_t DEMO_PXP_StartFillRects(void *dest,
+                                 uint32_t strideBytes,
+                                 uint8_t bytePerPixel,
+                                 uint32_t color,
+                                 const demo_pxp_rect_t *rects,
+                                 uint32_t rectCount)
+{
+    if ((rectCount > DEMO_PXP_COPY_RECT_MAX) || ((bytePerPixel != 2U) && (bytePerPixel != 4U)))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    DEMO_PXP_WaitJob(&s_fillJob.job);
+
+    if (0U == rectCount)
+    {
+        return kStatus_Success;
+    }
+
+    s_fillJob.fillConfig.destPicBaseAddr = (uint32_t)dest;
+    s_fillJob.fillConfig.destPitchBytes  = (uint16_t)strideBytes;
+    s_fillJob.fillConfig.color           = color;
+    s_fillJob.fillConfig.pixelFormat =
+        (bytePerPixel == 4U) ? kPXP_OutputPixelFormatRGB888 : kPXP_OutputPixelFormatRGB565;
+    s_fillJob.rectCount = rectCount;
+    s_fillJob.rectIndex = 0U;
+    (void)memcpy(s_fillJob.rects, rects, rectCount * sizeof(demo_pxp_rect_t));
+
+    DEMO_PXP_SubmitJob(&s_fillJob.job);
+
+    return kStatus_Success;
+}
+
+status_t DEMO_PXP_StartPatternFill(void *dest,
+                                   uint32_t strideBytes,
+                                   uint8_t bytePerPixel,
+                                   const demo_pxp_rect_t *rect,
+                                   const void *pattern,
+                                   uint32_t patternStrideBytes,
+                                   uint16_t patternWidth,
+                                   uint16_t patternHeight)
+{
+    if ((0U == patternWidth) || (0U == patternHeight) || ((bytePerPixel != 2U) && (bytePerPixel != 4U)))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    DEMO_PXP_WaitJob(&s_patternJob.job);
+
+    if ((0U == rect->width) || (0U == rect->height))
+    {
+        return kStatus_Success;
+    }
+
+    s_patternJob.destAddr           = (uint32_t)dest;
+    s_patternJob.destStrideBytes    = (uint16_t)strideBytes;
+    s_patternJob.patternAddr        = (uint32_t)pattern;
+    s_patternJob.patternStrideBytes = (uint16_t)patternStrideBytes;
+    s_patternJob.pixelFormat        = (bytePerPixel == 4U) ? kPXP_AsPixelFormatARGB8888 : kPXP_AsPixelFormatRGB565;
+    s_patternJob.rect               = *rect;
+    s_patternJob.tileWidth          = MIN(patternWidth, rect->width);
+    s_patternJob.tileHeight         = MIN(patternHeight, rect->height);
+    s_patternJob.filledWidth        = 0U;
+    s_patternJob.filledHeight       = 0U;
+
+    DEMO_PXP_SubmitJob(&s_patternJob.job);
+
+    return kStatus_Success;
+}
+
+bool DEMO_PXP_IsFillDone(void)
+{
+    return DEMO_PXP_IsJobDone(&s_fillJob.job) && DEMO_PXP_IsJobDone(&s_patternJob.job);
+}
+
+void DEMO_PXP_WaitFill(void)
+{
+    DEMO_PXP_WaitJob(&s_fillJob.job);
+    DEMO_PXP_WaitJob(&s_patternJob.job);
+}
+
+status_t DEMO_PXP_StartScale(void *dest,
+                             uint32_t destStrideBytes,
+                             const demo_pxp_rect_t *area,
+                             const void *src,
+                             uint32_t srcStrideBytes,
+                             uint16_t srcWidth,
+                             uint16_t srcHeight,
+                             uint8_t bytePerPixel)
+{
+    if ((bytePerPixel != 2U) && (bytePerPixel != 4U))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    DEMO_PXP_WaitScale();
+
+    if ((0U == area->width) || (0U == area->height) || (0U == srcWidth) || (0U == srcHeight))
+    {
+        return kStatus_Success;
+    }
+
+    /* The PXP could only down scale less than 16 times. */
+    if (((uint32_t)srcWidth >= (16UL * area->width)) || ((uint32_t)srcHeight >= (16UL * area->height)))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    if (4U == bytePerPixel)
+    {
+        DEMO_PXP_CmdInitScale(&s_scaleJob.cmd, kPXP_OutputPixelFormatARGB8888, DEMO_PXP_PS_FORMAT_32BPP);
+    }
+    else
+    {
+        DEMO_PXP_CmdInitScale(&s_scaleJob.cmd, kPXP_OutputPixelFormatRGB565, kPXP_PsPixelFormatRGB565);
+    }
+
+    DEMO_PXP_GetScalerConfig(srcWidth, srcHeight, area->width, area->height, &s_scaleJob.scaler);
+
+    s_scaleJob.destAddr        = (uint32_t)dest;
+    s_scaleJob.destStrideBytes = (uint16_t)destStrideBytes;
+    s_scaleJob.srcAddr         = (uint32_t)src;
+    s_scaleJob.srcStrideBytes  = (uint16_t)srcStrideBytes;
+    s_scaleJob.bytePerPixel    = bytePerPixel;
+    s_scaleJob.area            = *area;
+    s_scaleJob.tileX           = 0U;
+    s_scaleJob.tileY           = 0U;
+
+    DEMO_PXP_SubmitJob(&s_scaleJob.job);
+
+    return kStatus_Success;
+}
+
+bool DEMO_PXP_IsScaleDone(void)
+{
+    return DEMO_PXP_IsJobDone(&s_scaleJob.job);
+}
+
+void DEMO_PXP_WaitScale(void)
+{
+    DEMO_PXP_WaitJob(&s_scaleJob.job);
+}
+
+status_t DEMO_PXP_DrawIndexedImage(void *dest,
+                                   uint32_t destStrideBytes,
+                                   uint8_t bytePerPixel,
+                                   uint16_t x,
+                                   uint16_t y,
+                                   const demo_pxp_indexed_image_t *image)
+{
+    const demo_pxp_palette_entry_t *entry;
+    const uint8_t *src;
+    uint8_t *destLine;
+
+    if (((bytePerPixel != 2U) && (bytePerPixel != 4U)) || (image->paletteSize > 256U))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    if ((0U == image->width) || (0U == image->height))
+    {
+        return kStatus_Success;
+    }
+
+    entry    = DEMO_PXP_GetPalette(image->palette, image->paletteSize, bytePerPixel);
+    src      = image->index;
+    destLine = (uint8_t *)dest + (uint32_t)y * destStrideBytes + (uint32_t)x * bytePerPixel;
+
+    for (uint32_t row = 0U; row < image->height; row++)
+    {
+        if (4U == bytePerPixel)
+        {
+            uint32_t *destPixel = (uint32_t *)(void *)destLine;
+
+            for (uint32_t col = 0U; col < image->width; col++)
+            {
+                destPixel[col] = entry->table.xrgb8888[src[col]];
+            }
+        }
+        else
+        {
+            uint16_t *destPixel = (uint16_t *)(void *)destLine;
+
+            for (uint32_t col = 0U; col < image->width; col++)
+            {
+                destPixel[col] = entry->table.rgb565[src[col]];
+            }
+        }
+
+        src += image->strideBytes;
+        destLine += destStrideBytes;
+    }
+
+    return kStatus_Success;
+}
+
+void DEMO_PXP_InvalidatePaletteCache(void)
+{
+    for (uint32_t i = 0U; i < DEMO_PXP_PALETTE_CACHE_SIZE; i++)
+    {
+        s_paletteCache[i].lastUse = 0U;
+    }
+}
+
+status_t DEMO_PXP_InitMemCopy(demo_pxp_memcopy_t *handle)
+{
+    handle->size     = 0U;
+    handle->bodySize = 0U;
+
+    return DEMO_PXP_InitJob(&handle->job, DEMO_PXP_RunMemCopy, NULL, NULL);
+}
+
+void DEMO_PXP_StartMemCopy(demo_pxp_memcopy_t *handle, void *dest, const void *src, uint32_t size)
+{
+    uint32_t destAddr = (uint32_t)dest;
+    uint32_t srcAddr  = (uint32_t)src;
+    uint32_t headSize;
+    uint32_t bodySize = 0U;
+
+    DEMO_PXP_WaitMemCopy(handle);
+
+    /* Head: CPU copies until the destination is cache line aligned. */
+    headSize = (DEMO_PXP_CACHE_LINE_BYTES - (destAddr % DEMO_PXP_CACHE_LINE_BYTES)) % DEMO_PXP_CACHE_LINE_BYTES;
+
+    /* PXP copies 32-bit pixels, the source must be 4-byte aligned as the destination. */
+    if ((size >= s_memCopyMinBytes) && (0U == ((destAddr ^ srcAddr) & 3U)) && (headSize < size))
+    {
+        bodySize = ((size - headSize) / DEMO_PXP_MEMCOPY_ALIGN) * DEMO_PXP_MEMCOPY_ALIGN;
+    }
+
+    if (0U == bodySize)
+    {
+        (void)memcpy(dest, src, size);
+        return;
+    }
+
+    handle->srcAddr  = srcAddr + headSize;
+    handle->destAddr = destAddr + headSize;
+    handle->size     = bodySize;
+    handle->bodyAddr = destAddr + headSize;
+    handle->bodySize = bodySize;
+
+    /*
+     * The PXP part is cache line aligned, it shares no cache line with the CPU
+     * part, so dropping its destination lines loses nothing.
+     */
+    DEMO_PXP_CleanCache(handle->srcAddr, bodySize);
+    DEMO_PXP_InvalidateCache(handle->destAddr, bodySize);
+
+    DEMO_PXP_SubmitJob(&handle->job);
+
+    /* Head and tail are copied while PXP is working. */
+    (void)memcpy(dest, src, headSize);
+    (void)memcpy((uint8_t *)dest + headSize + bodySize, (const uint8_t *)src + headSize + bodySize,
+                 size - headSize - bodySize);
+}
+
+bool DEMO_PXP_IsMemCopyDone(const demo_pxp_memcopy_t *handle)
+{
+    return DEMO_PXP_IsJobDone(&handle->job);
+}
+
+void DEMO_PXP_WaitMemCopy(demo_pxp_memcopy_t *handle)
+{
+    DEMO_PXP_WaitJob(&handle->job);
+
+    /* CPU might prefetch the destination while PXP was writing it. */
+    if (0U != handle->bodySize)
+    {
+        DEMO_PXP_InvalidateCache(handle->bodyAddr, handle->bodySize);
+        handle->bodySize = 0U;
+    }
+}
+
+void DEMO_PXP_SetMemCopyThreshold(uint32_t minBytes)
+{
+    s_memCopyMinBytes = minBytes;
+}
+
+uint32_t DEMO_PXP_BenchmarkMemCopy(void *dest, const void *src, uint32_t maxSize)
+{
+    demo_pxp_memcopy_t handle;
+    uint32_t crossover = UINT32_MAX;
+    uint32_t cpuCycles;
+    uint32_t pxpCycles;
+    uint32_t start;
+    uint32_t cycles;
+
+    if (kStatus_Success != DEMO_PXP_InitMemCopy(&handle))
+    {
+        return UINT32_MAX;
+    }
+
+    MSDK_EnableCpuCycleCounter();
+
+    /* Force the PXP path during the measurement. */
+    s_memCopyMinBytes = 0U;
+
+    PRINTF("PXP memcopy benchmark, bytes: CPU us, PXP us\r\n");
+
+    for (uint32_t size = DEMO_PXP_MEMCOPY_ALIGN; size <= maxSize; size *= 2U)
+    {
+        cpuCycles = UINT32_MAX;
+        pxpCycles = UINT32_MAX;
+
+        for (uint32_t i = 0U; i < DEMO_PXP_BENCHMARK_REPEAT; i++)
+        {
+            start = MSDK_GetCpuCycleCount();
+            (void)memcpy(dest, src, size);
+            cycles    = MSDK_GetCpuCycleCount() - start;
+            cpuCycles = MIN(cpuCycles, cycles);
+
+            start = MSDK_GetCpuCycleCount();
+            DEMO_PXP_StartMemCopy(&handle, dest, src, size);
+            DEMO_PXP_WaitMemCopy(&handle);
+            cycles    = MSDK_GetCpuCycleCount() - start;
+            pxpCycles = MIN(pxpCycles, cycles);
+        }
+
+        PRINTF("%u: %u, %u\r\n", (unsigned int)size, (unsigned int)COUNT_TO_USEC(cpuCycles, SystemCoreClock),
+               (unsigned int)COUNT_TO_USEC(pxpCycles, SystemCoreClock));
+
+        /* The crossover is where PXP becomes and stays faster. */
+        if (pxpCycles < cpuCycles)
+        {
+            if (UINT32_MAX == crossover)
+            {
+                crossover = size;
+            }
+        }
+        else
+        {
+            crossover = UINT32_MAX;
+        }
+
+        /* Next size would overflow. */
+        if (size > (UINT32_MAX / 2U))
+        {
+            break;
+        }
+    }
+
+#if defined(SDK_OS_FREE_RTOS)
+    vSemaphoreDelete(handle.job.done);
+#endif
+
+    s_memCopyMinBytes = crossover;
+
+    PRINTF("PXP memcopy crossover: %u bytes\r\n", (unsigned int)crossover);
+
+    return crossover;
+}
+
+status_t DEMO_PXP_InitBlitBatch(demo_pxp_blit_batch_t *batch, demo_pxp_job_callback_t callback, void *param)
+{
+    (void)memset(&batch->stat, 0, sizeof(batch->stat));
+
+    MSDK_EnableCpuCycleCounter();
+
+    return DEMO_PXP_InitJob(&batch->job, DEMO_PXP_RunBlitBatch, callback, param);
+}
+
+status_t DEMO_PXP_StartBlitBatch(demo_pxp_blit_batch_t *batch,
+                                 uint8_t destBytePerPixel,
+                                 const demo_pxp_blit_t *blits,
+                                 uint32_t blitCount)
+{
+    const demo_pxp_blit_t *blit;
+    pxp_output_pixel_format_t destFormat;
+    pxp_ps_pixel_format_t psFormat;
+    uint32_t pixelCount  = 0U;
+    uint32_t configCount = 0U;
+
+    if ((blitCount > DEMO_PXP_BLIT_MAX) || ((destBytePerPixel != 2U) && (destBytePerPixel != 4U)))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    for (uint32_t i = 0U; i < blitCount; i++)
+    {
+        if ((kPXP_AsPixelFormatARGB8888 != blits[i].srcFormat) && (kPXP_AsPixelFormatRGB888 != blits[i].srcFormat) &&
+            (kPXP_AsPixelFormatRGB565 != blits[i].srcFormat))
+        {
+            return kStatus_InvalidArgument;
+        }
+
+        if (blits[i].mode >= kPXP_PorterDuffMax)
+        {
+            return kStatus_InvalidArgument;
+        }
+    }
+
+    DEMO_PXP_WaitBlitBatch(batch);
+
+    if (0U == blitCount)
+    {
+        return kStatus_Success;
+    }
+
+    if (4U == destBytePerPixel)
+    {
+        destFormat = kPXP_OutputPixelFormatARGB8888;
+        psFormat   = DEMO_PXP_PS_FORMAT_32BPP;
+    }
+    else
+    {
+        destFormat = kPXP_OutputPixelFormatRGB565;
+        psFormat   = kPXP_PsPixelFormatRGB565;
+    }
+
+    (void)memcpy(batch->blits, blits, blitCount * sizeof(demo_pxp_blit_t));
+    DEMO_PXP_SortBlits(batch->blits, blitCount);
+
+    batch->reconfigMask = 0U;
+
+    for (uint32_t i = 0U; i < blitCount; i++)
+    {
+        blit = &batch->blits[i];
+
+        if ((0U == i) || (!DEMO_PXP_IsSameBlitConfig(&batch->blits[i - 1U], blit)))
+        {
+            DEMO_PXP_GetBlitConfig(blit, &batch->pdConfigs[i]);
+            batch->reconfigMask |= (1UL << i);
+            configCount++;
+        }
+        else
+        {
+            batch->pdConfigs[i] = batch->pdConfigs[i - 1U];
+        }
+
+        DEMO_PXP_CmdInitBlend(&batch->cmds[i], destFormat, psFormat, blit->srcFormat);
+        DEMO_PXP_CmdSetBlend(&batch->cmds[i],
+                             (uint32_t)blit->dest + (uint32_t)blit->area.y * blit->destStrideBytes +
+                                 (uint32_t)blit->area.x * destBytePerPixel,
+                             (uint16_t)blit->destStrideBytes, (uint32_t)blit->src, (uint16_t)blit->srcStrideBytes,
+                             blit->area.width, blit->area.height);
+
+        pixelCount += (uint32_t)blit->area.width * blit->area.height;
+    }
+
+    batch->blitIndex        = 0U;
+    batch->stat.blitCount   = blitCount;
+    batch->stat.configCount = configCount;
+    batch->stat.pixelCount  = pixelCount;
+    batch->stat.cycles      = 0U;
+
+    DEMO_PXP_SubmitJob(&batch->job);
+
+    return kStatus_Success;
+}
+
+bool DEMO_PXP_IsBlitBatchDone(const demo_pxp_blit_batch_t *batch)
+{
+    return DEMO_PXP_IsJobDone(&batch->job);
+}
+
+void DEMO_PXP_WaitBlitBatch(demo_pxp_blit_batch_t *batch)
+{
+    DEMO_PXP_WaitJob(&batch->job);
+}
+
+void DEMO_PXP_GetBlitBatchStat(const demo_pxp_blit_batch_t *batch, demo_pxp_blit_stat_t *stat)
+{
+    *stat = batch->stat;
+}
@@ -0,0 +1,671 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _PXP_SUPPORT_H_
+#define _PXP_SUPPORT_H_
+
+#include "fsl_common.h"
+#include "fsl_pxp.h"
+#include "pxp_command.h"
+#if defined(SDK_OS_FREE_RTOS)
+#include "FreeRTOS.h"
+#include "semphr.h"
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Max rectangles in one copy, rotate or fill job. */
+#ifndef DEMO_PXP_COPY_RECT_MAX
+#define DEMO_PXP_COPY_RECT_MAX 32U
+#endif
+
+/*
+ * Max bytes copied by PXP in one operation of DEMO_PXP_StartMemCopy, it must be
+ * a multiple of 512. Default is the most one PXP operation could copy.
+ */
+#ifndef DEMO_PXP_MEMCOPY_CHUNK_BYTES
+#define DEMO_PXP_MEMCOPY_CHUNK_BYTES (((PXP_OUT_LRC_Y_MASK >> PXP_OUT_LRC_Y_SHIFT) + 1U) * 512U)
+#endif
+
+/*
+ * Copies smaller than this are done by CPU only. The default could be replaced
+ * by the result of DEMO_PXP_BenchmarkMemCopy.
+ */
+#ifndef DEMO_PXP_MEMCOPY_MIN_BYTES
+#define DEMO_PXP_MEMCOPY_MIN_BYTES 8192U
+#endif
+
+/* Scaler configurations kept by DEMO_PXP_StartScale, the least recently used one is replaced. */
+#ifndef DEMO_PXP_SCALER_CACHE_SIZE
+#define DEMO_PXP_SCALER_CACHE_SIZE 8U
+#endif
+
+/*
+ * Max output width and height of one PXP operation of DEMO_PXP_StartScale,
+ * larger outputs are split to tiles. Default is the most the output registers could hold.
+ */
+#ifndef DEMO_PXP_SCALE_TILE_MAX
+#define DEMO_PXP_SCALE_TILE_MAX ((PXP_OUT_LRC_X_MASK >> PXP_OUT_LRC_X_SHIFT) + 1U)
+#endif
+
+/* Palettes converted to the destination pixel format, kept by DEMO_PXP_DrawIndexedImage. */
+#ifndef DEMO_PXP_PALETTE_CACHE_SIZE
+#define DEMO_PXP_PALETTE_CACHE_SIZE 4U
+#endif
+
+/* Max blits in one batch of DEMO_PXP_StartBlitBatch, at most 32. */
+#ifndef DEMO_PXP_BLIT_MAX
+#define DEMO_PXP_BLIT_MAX 16U
+#endif
+
+/*
+ * Share the PXP with the LVGL PXP draw unit (LV_USE_PXP), define it to 1 in the
+ * project together with LV_USE_PXP. LVGL defines PXP_IRQHandler, DEMO_PXP_Init
+ * installs a handler in front of it with InstallIRQHandler, so the vector table
+ * must be in RAM (ENABLE_RAM_VECTOR_TABLE). The completions of the queued jobs
+ * are handled by DEMO_PXP_IRQHandler, the others are passed to LVGL. LVGL must
+ * only use the PXP between DEMO_PXP_Lock and DEMO_PXP_Unlock.
+ */
+#ifndef DEMO_PXP_SHARE_LVGL
+#define DEMO_PXP_SHARE_LVGL 0
+#endif
+
+#if DEMO_PXP_SHARE_LVGL && !defined(ENABLE_RAM_VECTOR_TABLE)
+#error "DEMO_PXP_SHARE_LVGL needs ENABLE_RAM_VECTOR_TABLE"
+#endif
+
+/*
+ * PXP_IRQHandler is defined here. Set it to 0 if the PXP interrupt is owned by
+ * other software, then DEMO_PXP_IRQHandler should be called by that interrupt
+ * handler.
+ */
+#if DEMO_PXP_SHARE_LVGL
+#undef DEMO_PXP_HANDLE_IRQ
+#define DEMO_PXP_HANDLE_IRQ 0
+#endif
+
+#ifndef DEMO_PXP_HANDLE_IRQ
+#define DEMO_PXP_HANDLE_IRQ 1
+#endif
+
+/*! @brief Rectangle in image. */
+typedef struct _demo_pxp_rect
+{
+    uint16_t x;      /*!< Left position. */
+    uint16_t y;      /*!< Top position. */
+    uint16_t width;  /*!< Width in pixel. */
+    uint16_t height; /*!< Height in pixel. */
+} demo_pxp_rect_t;
+
+/*! @brief Rectangle rotated by PXP. */
+typedef struct _demo_pxp_rotate_rect
+{
+    demo_pxp_rect_t src; /*!< Rectangle in source image. */
+    uint16_t destX;      /*!< Left position of the rotated rectangle in destination image. */
+    uint16_t destY;      /*!< Top position of the rotated rectangle in destination image. */
+} demo_pxp_rotate_rect_t;
+
+typedef struct _demo_pxp_job demo_pxp_job_t;
+
+/*!
+ * @brief Start the next PXP operation of a job.
+ *
+ * Called when the job is started, then in the PXP interrupt every time the
+ * previous operation is done. The function programs the PXP and starts it.
+ *
+ * @param job The job.
+ * @return true if an operation is started, false if the job is finished.
+ */
+typedef bool (*demo_pxp_job_run_t)(demo_pxp_job_t *job);
+
+/*!
+ * @brief Job done callback, called in the PXP interrupt.
+ *
+ * @param job The finished job, it could not be submitted again in the callback.
+ * @param param Parameter passed to @ref DEMO_PXP_InitJob.
+ */
+typedef void (*demo_pxp_job_callback_t)(demo_pxp_job_t *job, void *param);
+
+/*!
+ * @brief PXP job.
+ *
+ * A job is a sequence of PXP operations, the jobs are queued and run one by one.
+ * The job memory is owned by the client, it must be kept until the job is done.
+ */
+struct _demo_pxp_job
+{
+    demo_pxp_job_run_t run;           /*!< Start the next operation. */
+    demo_pxp_job_callback_t callback; /*!< Job done callback, could be NULL. */
+    void *param;                      /*!< Parameter of the callback. */
+    demo_pxp_job_t *next;             /*!< Internal, next job in the queue. */
+    volatile bool busy;               /*!< Internal, the job is queued or running. */
+#if defined(SDK_OS_FREE_RTOS)
+    SemaphoreHandle_t done; /*!< Internal, released when the job is done. */
+#endif
+};
+
+/*!
+ * @brief Memory copy handle, see @ref DEMO_PXP_StartMemCopy.
+ *
+ * All members are internal.
+ */
+typedef struct _demo_pxp_memcopy
+{
+    demo_pxp_job_t job; /*!< The PXP job. */
+    uint32_t destAddr;  /*!< Destination of the next PXP operation. */
+    uint32_t srcAddr;   /*!< Source of the next PXP operation. */
+    uint32_t size;      /*!< Bytes not started by PXP yet. */
+    uint32_t bodyAddr;  /*!< Destination written by PXP. */
+    uint32_t bodySize;  /*!< Bytes written by PXP, 0 if the cache is already invalidated. */
+} demo_pxp_memcopy_t;
+
+/*! @brief Blit descriptor, the source is blended onto an area of the destination. */
+typedef struct _demo_pxp_blit
+{
+    const void *src;                   /*!< Source pixel blended onto the top left of the area. */
+    uint32_t srcStrideBytes;           /*!< Stride of the source image in bytes. */
+    pxp_as_pixel_format_t srcFormat;   /*!< ARGB8888, RGB888 (XRGB8888) or RGB565. */
+    void *dest;                        /*!< Destination image. */
+    uint32_t destStrideBytes;          /*!< Stride of the destination image in bytes. */
+    demo_pxp_rect_t area;              /*!< Area in the destination image. */
+    uint8_t opa;                       /*!< Opacity of the source, 255 for opaque. */
+    pxp_porter_duff_blend_mode_t mode; /*!< Porter-Duff blend mode, the source is AS and the destination is PS. */
+} demo_pxp_blit_t;
+
+/*! @brief Throughput counters of one blit batch. */
+typedef struct _demo_pxp_blit_stat
+{
+    uint32_t blitCount;   /*!< Blits in the batch. */
+    uint32_t configCount; /*!< Porter-Duff configurations programmed. */
+    uint32_t pixelCount;  /*!< Destination pixels blended. */
+    uint32_t cycles;      /*!< CPU cycles from the first blit started to the batch done. */
+} demo_pxp_blit_stat_t;
+
+/*!
+ * @brief Blit batch handle, see @ref DEMO_PXP_StartBlitBatch.
+ *
+ * All members are internal.
+ */
+typedef struct _demo_pxp_blit_batch
+{
+    demo_pxp_job_t job;        /*!< The PXP job. */
+    uint32_t blitIndex;        /*!< Next blit to start. */
+    uint32_t reconfigMask;     /*!< Bit n set if blit n needs a new Porter-Duff configuration. */
+    uint32_t startCycle;       /*!< Cycle count when the first blit started. */
+    demo_pxp_blit_stat_t stat; /*!< Counters of the last batch. */
+    demo_pxp_blit_t blits[DEMO_PXP_BLIT_MAX];              /*!< Blits in start order. */
+    pxp_porter_duff_config_t pdConfigs[DEMO_PXP_BLIT_MAX]; /*!< Porter-Duff configuration of every blit. */
+    demo_pxp_cmd_t cmds[DEMO_PXP_BLIT_MAX];                /*!< Command of every blit. */
+} demo_pxp_blit_batch_t;
+
+/*! @brief Indexed color image, one byte color index per pixel. */
+typedef struct _demo_pxp_indexed_image
+{
+    const uint8_t *index;    /*!< Color indexes of the pixels. */
+    uint32_t strideBytes;    /*!< Stride of the indexes in bytes. */
+    uint16_t width;          /*!< Width in pixel. */
+    uint16_t height;         /*!< Height in pixel. */
+    const uint32_t *palette; /*!< Colors in XRGB8888, the same layout as the LCDIF LUT. */
+    uint16_t paletteSize;    /*!< Number of colors, at most 256, indexes out of it are black. */
+} demo_pxp_indexed_image_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * @brief Initialize the PXP, its interrupt and the job queue.
+ *
+ * @retval kStatus_Success Initialized successfully.
+ * @retval kStatus_Fail Failed to create the completion semaphores.
+ */
+status_t DEMO_PXP_Init(void);
+
+/*!
+ * @brief Initialize a job.
+ *
+ * @param job The job to initialize.
+ * @param run Function to start the job operations.
+ * @param callback Job done callback, could be NULL.
+ * @param param Parameter of the callback.
+ * @retval kStatus_Success Initialized successfully.
+ * @retval kStatus_Fail Failed to create the completion semaphore.
+ */
+status_t DEMO_PXP_InitJob(demo_pxp_job_t *job, demo_pxp_job_run_t run, demo_pxp_job_callback_t callback, void *param);
+
+/*!
+ * @brief Submit a job to the queue.
+ *
+ * The job is started at once if the PXP is idle, otherwise it is started in the
+ * PXP interrupt after the jobs before it are done. If the job has no operation,
+ * it is finished in this function and the callback is called here.
+ *
+ * @param job The job, it must not be busy.
+ */
+void DEMO_PXP_SubmitJob(demo_pxp_job_t *job);
+
+/*!
+ * @brief Check whether a job is done.
+ *
+ * @param job The job.
+ * @return true if the job is not queued or running.
+ */
+bool DEMO_PXP_IsJobDone(const demo_pxp_job_t *job);
+
+/*!
+ * @brief Wait for a job done, the calling task is blocked.
+ *
+ * @param job The job.
+ */
+void DEMO_PXP_WaitJob(demo_pxp_job_t *job);
+
+/*!
+ * @brief Lock the PXP for other software, such as the LVGL PXP draw unit.
+ *
+ * No queued job is started until @ref DEMO_PXP_Unlock, the job running is
+ * finished first, the calling task is blocked meanwhile. Jobs could still be
+ * submitted, but they must not be waited for by the lock owner.
+ */
+void DEMO_PXP_Lock(void);
+
+/*!
+ * @brief Unlock the PXP and start the jobs queued meanwhile.
+ *
+ * The PXP must be idle. The interrupt and the Porter-Duff configuration
+ * changed by the lock owner are restored. Nothing is done if not locked.
+ */
+void DEMO_PXP_Unlock(void);
+
+/*!
+ * @brief Start copying rectangles between two images in background.
+ *
+ * The rectangles are copied one by one, the next one is started in the PXP
+ * completion interrupt, so the CPU is free until the whole job is done. The two
+ * images have the same stride and pixel format, every rectangle is copied to the
+ * same position. If the previous copy job is not done, this function waits for it.
+ *
+ * The images must not be cached by CPU, or the cache lines shared by the copied
+ * pixels and the pixels written by CPU meanwhile get corrupted.
+ *
+ * @param dest Destination image.
+ * @param src Source image.
+ * @param strideBytes Stride of both images in bytes.
+ * @param bytePerPixel 2 for RGB565, 4 for XRGB8888 or ARGB8888.
+ * @param rects The rectangles, they are saved in the job, so could be reused after return.
+ * @param rectCount Number of rectangles, at most DEMO_PXP_COPY_RECT_MAX.
+ * @retval kStatus_Success The copy is started, or there is nothing to copy.
+ * @retval kStatus_InvalidArgument Too many rectangles or unsupported pixel size.
+ */
+status_t DEMO_PXP_StartCopyRects(void *dest,
+                                 const void *src,
+                                 uint32_t strideBytes,
+                                 uint8_t bytePerPixel,
+                                 const demo_pxp_rect_t *rects,
+                                 uint32_t rectCount);
+
+/*!
+ * @brief Check whether the copy job is done.
+ *
+ * @return true if there is no copy in progress.
+ */
+bool DEMO_PXP_IsCopyDone(void);
+
+/*!
+ * @brief Wait for the copy job done, the calling task is blocked.
+ */
+void DEMO_PXP_WaitCopy(void);
+
+/*!
+ * @brief Start rotating rectangles of the source image into the destination image in background.
+ *
+ * Works like @ref DEMO_PXP_StartCopyRects, every source rectangle is rotated and
+ * written to its destination position. If the previous rotate job is not done,
+ * this function waits for it.
+ *
+ * The source rectangles must be cleaned from the CPU cache, the destination
+ * image must not be cached by CPU.
+ *
+ * @param dest Destination image.
+ * @param destStrideBytes Stride of the destination image in bytes.
+ * @param src Source image.
+ * @param srcStrideBytes Stride of the source image in bytes.
+ * @param bytePerPixel 2 for RGB565, 4 for XRGB8888, same in both images.
+ * @param degree Clockwise rotate degree.
+ * @param rects The rectangles, they are saved in the job, so could be reused after return.
+ * @param rectCount Number of rectangles, at most DEMO_PXP_COPY_RECT_MAX.
+ * @retval kStatus_Success The rotation is started, or there is nothing to rotate.
+ * @retval kStatus_InvalidArgument Too many rectangles or unsupported pixel size.
+ */
+status_t DEMO_PXP_StartRotateRects(void *dest,
+                                   uint32_t destStrideBytes,
+                                   const void *src,
+                                   uint32_t srcStrideBytes,
+                                   uint8_t bytePerPixel,
+                                   pxp_rotate_degree_t degree,
+                                   const demo_pxp_rotate_rect_t *rects,
+                                   uint32_t rectCount);
+
+/*!
+ * @brief Check whether the rotate job is done.
+ *
+ * @return true if there is no rotation in progress.
+ */
+bool DEMO_PXP_IsRotateDone(void);
+
+/*!
+ * @brief Wait for the rotate job done, the calling task is blocked.
+ */
+void DEMO_PXP_WaitRotate(void);
+
+/*!
+ * @brief Start filling rectangles of an image with solid color in background.
+ *
+ * Every rectangle is one PXP operation without input surface, the next one is
+ * started in the PXP completion interrupt. If the previous solid fill job is
+ * not done, this function waits for it.
+ *
+ * The image must not be cached by CPU.
+ *
+ * @param dest Destination image.
+ * @param strideBytes Stride of the image in bytes.
+ * @param bytePerPixel 2 for RGB565, 4 for XRGB8888, the alpha byte is not set.
+ * @param color Fill color in ARGB8888 format.
+ * @param rects The rectangles, they are saved in the job, so could be reused after return.
+ * @param rectCount Number of rectangles, at most DEMO_PXP_COPY_RECT_MAX.
+ * @retval kStatus_Success The fill is started, or there is nothing to fill.
+ * @retval kStatus_InvalidArgument Too many rectangles or unsupported pixel size.
+ */
+status_t DEMO_PXP_StartFillRects(void *dest,
+                                 uint32_t strideBytes,
+                                 uint8_t bytePerPixel,
+                                 uint32_t color,
+                                 const demo_pxp_rect_t *rects,
+                                 uint32_t rectCount);
+
+/*!
+ * @brief Start filling a rectangle of an image with a repeated pattern in background.
+ *
+ * The pattern is tiled from the top left of the rectangle. The first tile is
+ * copied from the pattern, then the filled part is copied next to itself,
+ * doubling the width until the first tile row is done, then doubling the
+ * height. So only about log2(columns) + log2(rows) PXP operations are used.
+ * If the previous pattern fill job is not done, this function waits for it.
+ *
+ * The pattern must be cleaned from the CPU cache, the image must not be cached by CPU.
+ *
+ * @param dest Destination image.
+ * @param strideBytes Stride of the image in bytes.
+ * @param bytePerPixel 2 for RGB565, 4 for XRGB8888 or ARGB8888, same in the pattern.
+ * @param rect The rectangle to fill.
+ * @param pattern The pattern image.
+ * @param patternStrideBytes Stride of the pattern in bytes.
+ * @param patternWidth Pattern width in pixel.
+ * @param patternHeight Pattern height in pixel.
+ * @retval kStatus_Success The fill is started, or there is nothing to fill.
+ * @retval kStatus_InvalidArgument Empty pattern or unsupported pixel size.
+ */
+status_t DEMO_PXP_StartPatternFill(void *dest,
+                                   uint32_t strideBytes,
+                                   uint8_t bytePerPixel,
+                                   const demo_pxp_rect_t *rect,
+                                   const void *pattern,
+                                   uint32_t patternStrideBytes,
+                                   uint16_t patternWidth,
+                                   uint16_t patternHeight);
+
+/*!
+ * @brief Check whether the solid and pattern fill jobs are done.
+ *
+ * @return true if there is no fill in progress.
+ */
+bool DEMO_PXP_IsFillDone(void);
+
+/*!
+ * @brief Wait for the solid and pattern fill jobs done, the calling task is blocked.
+ */
+void DEMO_PXP_WaitFill(void);
+
+/*!
+ * @brief Start scaling an image into an area of the destination image in background.
+ *
+ * The scaler configuration of the input and output sizes is looked up in a
+ * small cache, it is only computed when the sizes are not used recently. The
+ * output is split to tiles of at most DEMO_PXP_SCALE_TILE_MAX pixels in both
+ * directions, every tile starts from its position in the source, so the
+ * result is the same as one operation. If the previous scale job is not done,
+ * this function waits for it.
+ *
+ * The source must be cleaned from the CPU cache, the destination image must
+ * not be cached by CPU.
+ *
+ * @param dest Destination image.
+ * @param destStrideBytes Stride of the destination image in bytes.
+ * @param area The scaled image area in the destination image.
+ * @param src Source image.
+ * @param srcStrideBytes Stride of the source image in bytes.
+ * @param srcWidth Source width in pixel.
+ * @param srcHeight Source height in pixel.
+ * @param bytePerPixel 2 for RGB565, 4 for XRGB8888, same in both images.
+ * @retval kStatus_Success The scale is started, or there is nothing to scale.
+ * @retval kStatus_InvalidArgument Unsupported pixel size, or down scaled by 16 or more.
+ */
+status_t DEMO_PXP_StartScale(void *dest,
+                             uint32_t destStrideBytes,
+                             const demo_pxp_rect_t *area,
+                             const void *src,
+                             uint32_t srcStrideBytes,
+                             uint16_t srcWidth,
+                             uint16_t srcHeight,
+                             uint8_t bytePerPixel);
+
+/*!
+ * @brief Check whether the scale job is done.
+ *
+ * @return true if there is no scale in progress.
+ */
+bool DEMO_PXP_IsScaleDone(void);
+
+/*!
+ * @brief Wait for the scale job done, the calling task is blocked.
+ */
+void DEMO_PXP_WaitScale(void);
+
+/*!
+ * @brief Draw an indexed color image into the destination image.
+ *
+ * This PXP has no LUT, so the indexes are expanded by CPU in this function.
+ * The palette is converted to the destination pixel format into a RAM table,
+ * the last DEMO_PXP_PALETTE_CACHE_SIZE tables are kept, so a palette used
+ * again is not converted again. Palettes are matched by address, call
+ * @ref DEMO_PXP_InvalidatePaletteCache after changing a palette in place.
+ *
+ * The destination is written by CPU, the caller must make sure no PXP job is
+ * writing the same area, and clean the area from the CPU cache before other
+ * masters read it.
+ *
+ * @param dest Destination image.
+ * @param destStrideBytes Stride of the destination image in bytes.
+ * @param bytePerPixel 2 for RGB565, 4 for XRGB8888.
+ * @param x Left position of the image in the destination image.
+ * @param y Top position of the image in the destination image.
+ * @param image The indexed color image.
+ * @retval kStatus_Success The image is drawn.
+ * @retval kStatus_InvalidArgument Unsupported pixel size or palette size.
+ */
+status_t DEMO_PXP_DrawIndexedImage(void *dest,
+                                   uint32_t destStrideBytes,
+                                   uint8_t bytePerPixel,
+                                   uint16_t x,
+                                   uint16_t y,
+                                   const demo_pxp_indexed_image_t *image);
+
+/*!
+ * @brief Drop all converted palettes kept by @ref DEMO_PXP_DrawIndexedImage.
+ */
+void DEMO_PXP_InvalidatePaletteCache(void);
+
+/*!
+ * @brief Initialize a memory copy handle.
+ *
+ * @param handle The handle.
+ * @retval kStatus_Success Initialized successfully.
+ * @retval kStatus_Fail Failed to create the completion semaphore.
+ */
+status_t DEMO_PXP_InitMemCopy(demo_pxp_memcopy_t *handle);
+
+/*!
+ * @brief Start copying memory of any size in background.
+ *
+ * The part aligned to the cache line and 512 bytes is copied by PXP, split into
+ * operations of at most DEMO_PXP_MEMCOPY_CHUNK_BYTES which are started one after
+ * another in the PXP interrupt. The unaligned head and tail are copied by CPU
+ * in this function while PXP is working. Small copies, or buffers which could
+ * not be aligned together, are copied by CPU only.
+ *
+ * The cache of the PXP part is maintained here and in @ref DEMO_PXP_WaitMemCopy.
+ * If the previous copy of the handle is not done, this function waits for it.
+ *
+ * @param handle The handle, it is the completion handle of the copy.
+ * @param dest Destination memory, it must not overlap with @p src.
+ * @param src Source memory.
+ * @param size Bytes to copy.
+ */
+void DEMO_PXP_StartMemCopy(demo_pxp_memcopy_t *handle, void *dest, const void *src, uint32_t size);
+
+/*!
+ * @brief Check whether the memory copy is done.
+ *
+ * Call @ref DEMO_PXP_WaitMemCopy before CPU reads the destination, it drops the
+ * cache lines prefetched while PXP was writing.
+ *
+ * @param handle The handle.
+ * @return true if there is no copy in progress.
+ */
+bool DEMO_PXP_IsMemCopyDone(const demo_pxp_memcopy_t *handle);
+
+/*!
+ * @brief Wait for the memory copy done, the calling task is blocked.
+ *
+ * @param handle The handle.
+ */
+void DEMO_PXP_WaitMemCopy(demo_pxp_memcopy_t *handle);
+
+/*!
+ * @brief Set the size from which DEMO_PXP_StartMemCopy uses PXP.
+ *
+ * @param minBytes Copies smaller than this are done by CPU only.
+ */
+void DEMO_PXP_SetMemCopyThreshold(uint32_t minBytes);
+
+/*!
+ * @brief Measure the memory copy by CPU and by PXP, and use the crossover size as threshold.
+ *
+ * Sizes from 512 bytes up to @p maxSize, doubled every step, are copied by
+ * memcpy and by DEMO_PXP_StartMemCopy until done. The results are printed, the
+ * smallest size from which PXP is always faster is set by
+ * @ref DEMO_PXP_SetMemCopyThreshold. The CPU time doesn't include the later
+ * write back of the destination cache lines.
+ *
+ * @param dest Destination memory, at least @p maxSize bytes, its content is destroyed.
+ * @param src Source memory, at least @p maxSize bytes.
+ * @param maxSize The biggest size measured.
+ * @return The crossover size, UINT32_MAX if PXP is never faster.
+ */
+uint32_t DEMO_PXP_BenchmarkMemCopy(void *dest, const void *src, uint32_t maxSize);
+
+/*!
+ * @brief Initialize a blit batch handle.
+ *
+ * @param batch The handle.
+ * @param callback Batch done callback, could be NULL.
+ * @param param Parameter of the callback.
+ * @retval kStatus_Success Initialized successfully.
+ * @retval kStatus_Fail Failed to create the completion semaphore.
+ */
+status_t DEMO_PXP_InitBlitBatch(demo_pxp_blit_batch_t *batch, demo_pxp_job_callback_t callback, void *param);
+
+/*!
+ * @brief Start blending a list of blits in background.
+ *
+ * The blits are reordered so the ones with the same format, opacity and blend
+ * mode are next to each other, a blit is only moved before the ones whose
+ * destination area it doesn't overlap, so the result is the same as in the
+ * given order. The commands of all blits are built here, then the batch is
+ * submitted as one job, the Porter-Duff configuration is only written when it
+ * changes. The batch completes once, with the callback and
+ * @ref DEMO_PXP_WaitBlitBatch. If the previous batch of the handle is not done,
+ * this function waits for it.
+ *
+ * The sources must be cleaned from the CPU cache, the destinations must not be
+ * cached by CPU. The sources must not be written by the batch.
+ *
+ * @param batch The handle.
+ * @param destBytePerPixel 2 for RGB565, 4 for XRGB8888, same in all destinations.
+ * @param blits The blits, they are saved in the handle, so could be reused after return.
+ * @param blitCount Number of blits, at most DEMO_PXP_BLIT_MAX.
+ * @retval kStatus_Success The batch is started, or there is nothing to blend.
+ * @retval kStatus_InvalidArgument Too many blits, unsupported pixel format or blend mode.
+ */
+status_t DEMO_PXP_StartBlitBatch(demo_pxp_blit_batch_t *batch,
+                                 uint8_t destBytePerPixel,
+                                 const demo_pxp_blit_t *blits,
+                                 uint32_t blitCount);
+
+/*!
+ * @brief Check whether the blit batch is done.
+ *
+ * @param batch The handle.
+ * @return true if there is no batch in progress.
+ */
+bool DEMO_PXP_IsBlitBatchDone(const demo_pxp_blit_batch_t *batch);
+
+/*!
+ * @brief Wait for the blit batch done, the calling task is blocked.
+ *
+ * @param batch The handle.
+ */
+void DEMO_PXP_WaitBlitBatch(demo_pxp_blit_batch_t *batch);
+
+/*!
+ * @brief Get the counters of the last finished blit batch.
+ *
+ * The throughput is pixelCount * SystemCoreClock / cycles pixels per second.
+ *
+ * @param batch The handle.
+ * @param stat Pointer to the counters.
+ */
+void DEMO_PXP_GetBlitBatchStat(const demo_pxp_blit_batch_t *batch, demo_pxp_blit_stat_t *stat);
+
+/*!
+ * @brief Start a prebuilt PXP command.
+ *
+ * Called by the job run function, the whole operation is started by writing
+ * the command address to the NEXT register, the command is cleaned from the
+ * CPU cache here. The command memory could be reused when the operation is done.
+ *
+ * The PXP must be idle. The Porter-Duff configuration is not part of the
+ * command, a job enabling it must disable it when the job is done.
+ *
+ * @param cmd The command.
+ */
+void DEMO_PXP_StartCommand(const demo_pxp_cmd_t *cmd);
+
+/*!
+ * @brief PXP interrupt handler of the job queue.
+ */
+void DEMO_PXP_IRQHandler(void);
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+#endif /* _PXP_SUPPORT_H_ */
@@ -0,0 +1,293 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "rotate_support.h"
+#include <string.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*
+ * Source pixel walk for the destination rectangle: src points to the source
+ * pixel of the destination top left pixel, colStep is the source byte offset
+ * when moving one pixel right in destination, rowStep is the source byte offset
+ * when moving one pixel down in destination.
+ */
+typedef struct _demo_rotate_walk
+{
+    const uint8_t *src;
+    int32_t colStep;
+    int32_t rowStep;
+} demo_rotate_walk_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static void DEMO_RotateTiles16(uint8_t *dest,
+                               uint32_t destStrideBytes,
+                               const demo_rotate_walk_t *walk,
+                               uint32_t width,
+                               uint32_t height,
+                               uint32_t tileSize);
+
+static void DEMO_RotateTiles32(uint8_t *dest,
+                               uint32_t destStrideBytes,
+                               const demo_rotate_walk_t *walk,
+                               uint32_t width,
+                               uint32_t height,
+                               uint32_t tileSize);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static void DEMO_RotateTiles16(uint8_t *dest,
+                               uint32_t destStrideBytes,
+                               const demo_rotate_walk_t *walk,
+                               uint32_t width,
+                               uint32_t height,
+                               uint32_t tileSize)
+{
+    const int32_t colStep = walk->colStep;
+    uint32_t tileWidth;
+    uint32_t tileHeight;
+    uint32_t col;
+    uint16_t *destPixel;
+    const uint8_t *srcPixel;
+    uint32_t pixel0;
+    uint32_t pixel1;
+
+    for (uint32_t tileY = 0U; tileY < height; tileY += tileSize)
+    {
+        tileHeight = MIN(tileSize, height - tileY);
+
+        for (uint32_t tileX = 0U; tileX < width; tileX += tileSize)
+        {
+            tileWidth = MIN(tileSize, width - tileX);
+
+            for (uint32_t row = tileY; row < tileY + tileHeight; row++)
+            {
+                destPixel = (uint16_t *)(void *)(dest + row * destStrideBytes) + tileX;
+                srcPixel  = walk->src + (int32_t)row * walk->rowStep + (int32_t)tileX * colStep;
+                col       = 0U;
+
+                /* Align the destination to 32-bit, then write two pixels at once. */
+                if ((0U != ((uintptr_t)destPixel & 0x02U)) && (tileWidth > 0U))
+                {
+                    *destPixel++ = *(const uint16_t *)(const void *)srcPixel;
+                    srcPixel += colStep;
+                    col++;
+                }
+
+                for (; (col + 1U) < tileWidth; col += 2U)
+                {
+                    pixel0 = *(const uint16_t *)(const void *)srcPixel;
+                    srcPixel += colStep;
+                    pixel1 = *(const uint16_t *)(const void *)srcPixel;
+                    srcPixel += colStep;
+
+                    *(uint32_t *)(void *)destPixel = pixel0 | (pixel1 << 16U);
+                    destPixel += 2;
+                }
+
+                if (col < tileWidth)
+                {
+                    *destPixel = *(const uint16_t *)(const void *)srcPixel;
+                }
+            }
+        }
+    }
+}
+
+static void DEMO_RotateTiles32(uint8_t *dest,
+                               uint32_t destStrideBytes,
+                               const demo_rotate_walk_t *walk,
+                               uint32_t width,
+                               uint32_t height,
+                               uint32_t tileSize)
+{
+    const int32_t colStep = walk->colStep;
+    const int32_t rowStep = walk->rowStep;
+    /*
+     * For 90 and 270 degree, the source pixels of one destination column are
+     * adjacent, so the tile is walked column by column. The destination rows
+     * of the tile stay in cache, the scattered stores are cheap.
+     */
+    const bool columnWalk = ((rowStep == 4) || (rowStep == -4));
+    uint32_t tileWidth;
+    uint32_t tileHeight;
+    uint8_t *destPixel;
+    const uint8_t *srcPixel;
+
+    for (uint32_t tileY = 0U; tileY < height; tileY += tileSize)
+    {
+        tileHeight = MIN(tileSize, height - tileY);
+
+        for (uint32_t tileX = 0U; tileX < width; tileX += tileSize)
+        {
+            tileWidth = MIN(tileSize, width - tileX);
+
+            if (columnWalk)
+            {
+                for (uint32_t col = tileX; col < tileX + tileWidth; col++)
+                {
+                    destPixel = dest + tileY * destStrideBytes + col * 4U;
+                    srcPixel  = walk->src + (int32_t)tileY * rowStep + (int32_t)col * colStep;
+
+                    for (uint32_t row = 0U; row < tileHeight; row++)
+                    {
+                        *(uint32_t *)(void *)destPixel = *(const uint32_t *)(const void *)srcPixel;
+                        destPixel += destStrideBytes;
+                        srcPixel += rowStep;
+                    }
+                }
+            }
+            else
+            {
+                for (uint32_t row = tileY; row < tileY + tileHeight; row++)
+                {
+                    destPixel = dest + row * destStrideBytes + tileX * 4U;
+                    srcPixel  = walk->src + (int32_t)row * rowStep + (int32_t)tileX * colStep;
+
+                    for (uint32_t col = 0U; col < tileWidth; col++)
+                    {
+                        *(uint32_t *)(void *)destPixel = *(const uint32_t *)(const void *)srcPixel;
+                        destPixel += 4U;
+                        srcPixel += colStep;
+                    }
+                }
+            }
+        }
+    }
+}
+
+void DEMO_GetRotatedRect(const demo_rotate_image_t *src,
+                         const demo_rotate_rect_t *srcRect,
+                         demo_rotate_degree_t degree,
+                         demo_rotate_rect_t *destRect)
+{
+    switch (degree)
+    {
+        case kDEMO_Rotate90:
+            destRect->x      = src->height - srcRect->y - srcRect->height;
+            destRect->y      = srcRect->x;
+            destRect->width  = srcRect->height;
+            destRect->height = srcRect->width;
+            break;
+
+        case kDEMO_Rotate180:
+            destRect->x      = src->width - srcRect->x - srcRect->width;
+            destRect->y      = src->height - srcRect->y - srcRect->height;
+            destRect->width  = srcRect->width;
+            destRect->height = srcRect->height;
+            break;
+
+        case kDEMO_Rotate270:
+            destRect->x      = srcRect->y;
+            destRect->y      = src->width - srcRect->x - srcRect->width;
+            destRect->width  = srcRect->height;
+            destRect->height = srcRect->width;
+            break;
+
+        default:
+            *destRect = *srcRect;
+            break;
+    }
+}
+
+void DEMO_RotateRect(const demo_rotate_image_t *dest,
+                     const demo_rotate_image_t *src,
+                     const demo_rotate_rect_t *srcRect,
+                     demo_rotate_degree_t degree)
+{
+    assert(dest->bytePerPixel == src->bytePerPixel);
+    assert((src->bytePerPixel == 2U) || (src->bytePerPixel == 4U));
+    assert((uint32_t)srcRect->x + srcRect->width <= src->width);
+    assert((uint32_t)srcRect->y + srcRect->height <= src->height);
+
+    const uint8_t bpp     = src->bytePerPixel;
+    const int32_t srcPitch = (int32_t)src->strideBytes;
+    const uint8_t *srcBuf = (const uint8_t *)src->buffer;
+    demo_rotate_rect_t destRect;
+    demo_rotate_walk_t walk;
+    uint32_t tileSize;
+    uint8_t *destStart;
+    uint32_t lastX;
+    uint32_t lastY;
+
+    if ((0U == srcRect->width) || (0U == srcRect->height))
+    {
+        return;
+    }
+
+    DEMO_GetRotatedRect(src, srcRect, degree, &destRect);
+
+    destStart = (uint8_t *)dest->buffer + destRect.y * dest->strideBytes + destRect.x * bpp;
+    lastX     = (uint32_t)srcRect->x + srcRect->width - 1U;
+    lastY     = (uint32_t)srcRect->y + srcRect->height - 1U;
+
+    /* Tile size in pixel, one tile row is one cache line. */
+    tileSize = DEMO_ROTATE_TILE_BYTES / bpp;
+
+    switch (degree)
+    {
+        case kDEMO_Rotate90:
+            walk.src     = srcBuf + lastY * src->strideBytes + srcRect->x * bpp;
+            walk.colStep = -srcPitch;
+            walk.rowStep = (int32_t)bpp;
+            break;
+
+        case kDEMO_Rotate180:
+            walk.src     = srcBuf + lastY * src->strideBytes + lastX * bpp;
+            walk.colStep = -(int32_t)bpp;
+            walk.rowStep = -srcPitch;
+            /* Both images are accessed line by line, tiling is not necessary. */
+            tileSize = destRect.width;
+            break;
+
+        case kDEMO_Rotate270:
+            walk.src     = srcBuf + srcRect->y * src->strideBytes + lastX * bpp;
+            walk.colStep = srcPitch;
+            walk.rowStep = -(int32_t)bpp;
+            break;
+
+        default:
+            srcBuf += srcRect->y * src->strideBytes + srcRect->x * bpp;
+            for (uint32_t row = 0U; row < destRect.height; row++)
+            {
+                (void)memcpy(destStart, srcBuf, (uint32_t)destRect.width * bpp);
+                destStart += dest->strideBytes;
+                srcBuf += src->strideBytes;
+            }
+            return;
+    }
+
+    if (2U == bpp)
+    {
+        DEMO_RotateTiles16(destStart, dest->strideBytes, &walk, destRect.width, destRect.height, tileSize);
+    }
+    else
+    {
+        DEMO_RotateTiles32(destStart, dest->strideBytes, &walk, destRect.width, destRect.height, tileSize);
+    }
+}
+
+void DEMO_Rotate(const demo_rotate_image_t *dest, const demo_rotate_image_t *src, demo_rotate_degree_t degree)
+{
+    const demo_rotate_rect_t rect = {
+        .x      = 0U,
+        .y      = 0U,
+        .width  = src->width,
+        .height = src->height,
+    };
+
+    DEMO_RotateRect(dest, src, &rect, degree);
+}
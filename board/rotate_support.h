@@ -0,0 +1,108 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _ROTATE_SUPPORT_H_
+#define _ROTATE_SUPPORT_H_
+
+#include "fsl_common.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*
+ * The rotation is done tile by tile. One tile row in the destination image is
+ * one cache line, and the source image lines read for a tile are reused by all
+ * rows of the tile, so both images are accessed cache friendly.
+ */
+#ifndef DEMO_ROTATE_TILE_BYTES
+#if defined(FSL_FEATURE_L1DCACHE_LINESIZE_BYTE) && (FSL_FEATURE_L1DCACHE_LINESIZE_BYTE > 0)
+#define DEMO_ROTATE_TILE_BYTES FSL_FEATURE_L1DCACHE_LINESIZE_BYTE
+#else
+#define DEMO_ROTATE_TILE_BYTES 32
+#endif
+#endif
+
+/*! @brief Clockwise rotate degree. */
+typedef enum _demo_rotate_degree
+{
+    kDEMO_Rotate0 = 0, /*!< No rotation, only copy. */
+    kDEMO_Rotate90,    /*!< Rotate 90 degree clockwise. */
+    kDEMO_Rotate180,   /*!< Rotate 180 degree clockwise. */
+    kDEMO_Rotate270,   /*!< Rotate 270 degree clockwise. */
+} demo_rotate_degree_t;
+
+/*! @brief Rectangle in image. */
+typedef struct _demo_rotate_rect
+{
+    uint16_t x;      /*!< Left position. */
+    uint16_t y;      /*!< Top position. */
+    uint16_t width;  /*!< Width in pixel. */
+    uint16_t height; /*!< Height in pixel. */
+} demo_rotate_rect_t;
+
+/*! @brief Image used by the rotation. */
+typedef struct _demo_rotate_image
+{
+    void *buffer;          /*!< Image base address. */
+    uint32_t strideBytes;  /*!< Image stride in bytes. */
+    uint16_t width;        /*!< Image width in pixel. */
+    uint16_t height;       /*!< Image height in pixel. */
+    uint8_t bytePerPixel;  /*!< 2 for RGB565, 4 for XRGB8888. */
+} demo_rotate_image_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * @brief Get the position of a source image rectangle in the rotated image.
+ *
+ * @param src Source image.
+ * @param srcRect Rectangle in source image.
+ * @param degree Clockwise rotate degree.
+ * @param destRect Output rectangle in destination image.
+ */
+void DEMO_GetRotatedRect(const demo_rotate_image_t *src,
+                         const demo_rotate_rect_t *srcRect,
+                         demo_rotate_degree_t degree,
+                         demo_rotate_rect_t *destRect);
+
+/*!
+ * @brief Rotate a rectangle of the source image into the destination image.
+ *
+ * Only the pixels inside @p srcRect are read, and only the pixels of the
+ * rotated rectangle are written, so the function could be used to update the
+ * dirty areas of a rotated frame buffer.
+ *
+ * @param dest Destination image, its size must be the rotated source image size.
+ * @param src Source image, its pixel format must be the same with @p dest.
+ * @param srcRect Rectangle in source image.
+ * @param degree Clockwise rotate degree.
+ */
+void DEMO_RotateRect(const demo_rotate_image_t *dest,
+                     const demo_rotate_image_t *src,
+                     const demo_rotate_rect_t *srcRect,
+                     demo_rotate_degree_t degree);
+
+/*!
+ * @brief Rotate the whole source image into the destination image.
+ *
+ * @param dest Destination image, its size must be the rotated source image size.
+ * @param src Source image, its pixel format must be the same with @p dest.
+ * @param degree Clockwise rotate degree.
+ */
+void DEMO_Rotate(const demo_rotate_image_t *dest, const demo_rotate_image_t *src, demo_rotate_degree_t degree);
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+#endif /* _ROTATE_SUPPORT_H_ */
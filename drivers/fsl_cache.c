@@ -600,3 +600,216 @@ void DCACHE_CleanInvalidateByRange(uint32_t address, uint32_t size_byte)
 #endif /* !FSL_SDK_DISBLE_L2CACHE_PRESENT */
 #endif /* FSL_FEATURE_SOC_L2CACHEC_COUNT */
 }
+
+#if (__DCACHE_PRESENT == 1U)
+/*!
+ * @brief Gets the L1 data cache size in bytes.
+ *
+ * @return The L1 data cache size read from the cache size ID register.
+ */
+static uint32_t L1CACHE_GetDCacheSize(void)
+{
+    static uint32_t s_dcacheSize = 0U;
+    uint32_t ccsidr;
+
+    if (0U == s_dcacheSize)
+    {
+        /* Select level 1 data cache. */
+        SCB->CSSELR = 0U;
+        __DSB();
+        ccsidr = SCB->CCSIDR;
+
+        s_dcacheSize = (CCSIDR_SETS(ccsidr) + 1U) * (CCSIDR_WAYS(ccsidr) + 1U) *
+                       (uint32_t)FSL_FEATURE_L1DCACHE_LINESIZE_BYTE;
+    }
+
+    return s_dcacheSize;
+}
+
+/*!
+ * @brief Gets the bytes of the cache lines touched by the rectangle.
+ *
+ * @param address The start address of the rectangle.
+ * @param stride_byte Distance in bytes between the start of two lines.
+ * @param width_byte Line size in bytes.
+ * @param height Number of lines.
+ * @return The bytes of the touched cache lines.
+ */
+static uint32_t L1CACHE_GetDCacheRectSize(uint32_t address, uint32_t stride_byte, uint32_t width_byte, uint32_t height)
+{
+    uint32_t lineStart = address & ~((uint32_t)FSL_FEATURE_L1DCACHE_LINESIZE_BYTE - 1U);
+    uint32_t lineBytes = address + width_byte - lineStart + (uint32_t)FSL_FEATURE_L1DCACHE_LINESIZE_BYTE - 1U;
+
+    lineBytes &= ~((uint32_t)FSL_FEATURE_L1DCACHE_LINESIZE_BYTE - 1U);
+
+    /* The lines overlap, the rectangle is a continuous range. */
+    if (lineBytes > stride_byte)
+    {
+        return stride_byte * (height - 1U) + lineBytes;
+    }
+
+    return lineBytes * height;
+}
+
+/*!
+ * @brief Operates cortex-m7 L1 data cache by rectangle.
+ *
+ * @param opReg The cache maintenance register, DCIMVAC, DCCMVAC or DCCIMVAC.
+ * @param address The start address of the rectangle.
+ * @param stride_byte Distance in bytes between the start of two lines.
+ * @param width_byte Line size in bytes.
+ * @param height Number of lines.
+ */
+static void L1CACHE_OperateDCacheByRect(
+    volatile uint32_t *opReg, uint32_t address, uint32_t stride_byte, uint32_t width_byte, uint32_t height)
+{
+    uint32_t addr;
+    uint32_t endAddr;
+
+    /* Continuous memory, operate as one line. */
+    if (stride_byte == width_byte)
+    {
+        width_byte *= height;
+        height = 1U;
+    }
+
+    __DSB();
+    while (height-- > 0U)
+    {
+        addr    = address & ~((uint32_t)FSL_FEATURE_L1DCACHE_LINESIZE_BYTE - 1U);
+        endAddr = address + width_byte;
+
+        while (addr < endAddr)
+        {
+            *opReg = addr;
+            addr += (uint32_t)FSL_FEATURE_L1DCACHE_LINESIZE_BYTE;
+        }
+
+        address += stride_byte;
+    }
+    __DSB();
+    __ISB();
+}
+#endif /* __DCACHE_PRESENT */
+
+/*!
+ * brief Invalidates all data caches by rectangle.
+ *
+ * The rectangle is height lines of width_byte bytes, the start address of each
+ * line is stride_byte after the previous line. Only the cache lines touched by
+ * the rectangle are operated, the memory between the lines is not affected.
+ *
+ * param address The physical address of the rectangle first line.
+ * param stride_byte Distance in bytes between the start of two lines.
+ * param width_byte Line size in bytes.
+ * param height Number of lines.
+ * note The same alignment requirement as DCACHE_InvalidateByRange applies
+ * to the start and end of each line. Whole cache invalidation could discard dirty
+ * data of other memory, so this function always operates by address.
+ */
+void DCACHE_InvalidateByRect(uint32_t address, uint32_t stride_byte, uint32_t width_byte, uint32_t height)
+{
+    if ((0U == width_byte) || (0U == height))
+    {
+        return;
+    }
+
+#if defined(FSL_FEATURE_SOC_L2CACHEC_COUNT) && FSL_FEATURE_SOC_L2CACHEC_COUNT
+#if defined(FSL_SDK_DISBLE_L2CACHE_PRESENT) && !FSL_SDK_DISBLE_L2CACHE_PRESENT
+    for (uint32_t i = 0U; i < height; i++)
+    {
+        L2CACHE_InvalidateByRange(address + i * stride_byte, width_byte);
+    }
+#endif /* !FSL_SDK_DISBLE_L2CACHE_PRESENT */
+#endif /* FSL_FEATURE_SOC_L2CACHEC_COUNT */
+
+#if (__DCACHE_PRESENT == 1U)
+    L1CACHE_OperateDCacheByRect(&SCB->DCIMVAC, address, stride_byte, width_byte, height);
+#endif
+}
+
+/*!
+ * brief Cleans all data caches by rectangle.
+ *
+ * The rectangle is height lines of width_byte bytes, the start address of each
+ * line is stride_byte after the previous line. Only the cache lines touched by
+ * the rectangle are cleaned. If the touched cache lines are more than the L1
+ * data cache could hold, the whole L1 data cache is cleaned by set/way instead,
+ * which is faster than operating every line by address.
+ *
+ * param address The physical address of the rectangle first line.
+ * param stride_byte Distance in bytes between the start of two lines.
+ * param width_byte Line size in bytes.
+ * param height Number of lines.
+ */
+void DCACHE_CleanByRect(uint32_t address, uint32_t stride_byte, uint32_t width_byte, uint32_t height)
+{
+    if ((0U == width_byte) || (0U == height))
+    {
+        return;
+    }
+
+#if (__DCACHE_PRESENT == 1U)
+    if (L1CACHE_GetDCacheRectSize(address, stride_byte, width_byte, height) >= L1CACHE_GetDCacheSize())
+    {
+        L1CACHE_CleanDCache();
+    }
+    else
+    {
+        L1CACHE_OperateDCacheByRect(&SCB->DCCMVAC, address, stride_byte, width_byte, height);
+    }
+#endif
+
+#if defined(FSL_FEATURE_SOC_L2CACHEC_COUNT) && FSL_FEATURE_SOC_L2CACHEC_COUNT
+#if defined(FSL_SDK_DISBLE_L2CACHE_PRESENT) && !FSL_SDK_DISBLE_L2CACHE_PRESENT
+    for (uint32_t i = 0U; i < height; i++)
+    {
+        L2CACHE_CleanByRange(address + i * stride_byte, width_byte);
+    }
+#endif /* !FSL_SDK_DISBLE_L2CACHE_PRESENT */
+#endif /* FSL_FEATURE_SOC_L2CACHEC_COUNT */
+}
+
+/*!
+ * brief Cleans and Invalidates all data caches by rectangle.
+ *
+ * The rectangle is height lines of width_byte bytes, the start address of each
+ * line is stride_byte after the previous line. Only the cache lines touched by
+ * the rectangle are operated. If the touched cache lines are more than the L1
+ * data cache could hold, the whole L1 data cache is cleaned and invalidated by
+ * set/way instead.
+ *
+ * param address The physical address of the rectangle first line.
+ * param stride_byte Distance in bytes between the start of two lines.
+ * param width_byte Line size in bytes.
+ * param height Number of lines.
+ * note The same alignment requirement as DCACHE_CleanInvalidateByRange
+ * applies to the start and end of each line.
+ */
+void DCACHE_CleanInvalidateByRect(uint32_t address, uint32_t stride_byte, uint32_t width_byte, uint32_t height)
+{
+    if ((0U == width_byte) || (0U == height))
+    {
+        return;
+    }
+
+#if (__DCACHE_PRESENT == 1U)
+    if (L1CACHE_GetDCacheRectSize(address, stride_byte, width_byte, height) >= L1CACHE_GetDCacheSize())
+    {
+        L1CACHE_CleanInvalidateDCache();
+    }
+    else
+    {
+        L1CACHE_OperateDCacheByRect(&SCB->DCCIMVAC, address, stride_byte, width_byte, height);
+    }
+#endif
+
+#if defined(FSL_FEATURE_SOC_L2CACHEC_COUNT) && FSL_FEATURE_SOC_L2CACHEC_COUNT
+#if defined(FSL_SDK_DISBLE_L2CACHE_PRESENT) && !FSL_SDK_DISBLE_L2CACHE_PRESENT
+    for (uint32_t i = 0U; i < height; i++)
+    {
+        L2CACHE_CleanInvalidateByRange(address + i * stride_byte, width_byte);
+    }
+#endif /* !FSL_SDK_DISBLE_L2CACHE_PRESENT */
+#endif /* FSL_FEATURE_SOC_L2CACHEC_COUNT */
+}
@@ -20,8 +20,8 @@
 
 /*! @name Driver version */
 /*! @{ */
-/*! @brief cache driver version 2.0.4. */
-#define FSL_CACHE_DRIVER_VERSION (MAKE_VERSION(2, 0, 4))
+/*! @brief cache driver version 2.1.0. */
+#define FSL_CACHE_DRIVER_VERSION (MAKE_VERSION(2, 1, 0))
 /*! @} */
 
 #if defined(FSL_FEATURE_SOC_L2CACHEC_COUNT) && FSL_FEATURE_SOC_L2CACHEC_COUNT
@@ -452,6 +452,57 @@ void DCACHE_CleanByRange(uint32_t address, uint32_t size_byte);
  */
 void DCACHE_CleanInvalidateByRange(uint32_t address, uint32_t size_byte);
 
+/*!
+ * @brief Invalidates all data caches by rectangle.
+ *
+ * The rectangle is height lines of width_byte bytes, the start address of each
+ * line is stride_byte after the previous line. Only the cache lines touched by
+ * the rectangle are operated, the memory between the lines is not affected.
+ *
+ * @param address The physical address of the rectangle first line.
+ * @param stride_byte Distance in bytes between the start of two lines.
+ * @param width_byte Line size in bytes.
+ * @param height Number of lines.
+ * @note The same alignment requirement as @ref DCACHE_InvalidateByRange applies
+ * to the start and end of each line. Whole cache invalidation could discard dirty
+ * data of other memory, so this function always operates by address.
+ */
+void DCACHE_InvalidateByRect(uint32_t address, uint32_t stride_byte, uint32_t width_byte, uint32_t height);
+
+/*!
+ * @brief Cleans all data caches by rectangle.
+ *
+ * The rectangle is height lines of width_byte bytes, the start address of each
+ * line is stride_byte after the previous line. Only the cache lines touched by
+ * the rectangle are cleaned. If the touched cache lines are more than the L1
+ * data cache could hold, the whole L1 data cache is cleaned by set/way instead,
+ * which is faster than operating every line by address.
+ *
+ * @param address The physical address of the rectangle first line.
+ * @param stride_byte Distance in bytes between the start of two lines.
+ * @param width_byte Line size in bytes.
+ * @param height Number of lines.
+ */
+void DCACHE_CleanByRect(uint32_t address, uint32_t stride_byte, uint32_t width_byte, uint32_t height);
+
+/*!
+ * @brief Cleans and Invalidates all data caches by rectangle.
+ *
+ * The rectangle is height lines of width_byte bytes, the start address of each
+ * line is stride_byte after the previous line. Only the cache lines touched by
+ * the rectangle are operated. If the touched cache lines are more than the L1
+ * data cache could hold, the whole L1 data cache is cleaned and invalidated by
+ * set/way instead.
+ *
+ * @param address The physical address of the rectangle first line.
+ * @param stride_byte Distance in bytes between the start of two lines.
+ * @param width_byte Line size in bytes.
+ * @param height Number of lines.
+ * @note The same alignment requirement as @ref DCACHE_CleanInvalidateByRange
+ * applies to the start and end of each line.
+ */
+void DCACHE_CleanInvalidateByRect(uint32_t address, uint32_t stride_byte, uint32_t width_byte, uint32_t height);
+
 /*! @} */
 
 #if defined(__cplusplus)
@@ -48,6 +48,43 @@
 #define PXP_ADDR_CPU_2_IP(addr) (addr)
 #endif /* FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET */
 
+#if PXP_USE_SHADOW_REGISTER
+/* Registers whose last written value is kept, they are only written by absolute value. */
+enum _pxp_shadow_reg
+{
+    kPXP_Shadow_OUT_BUF = 0U,
+    kPXP_Shadow_OUT_BUF2,
+    kPXP_Shadow_OUT_PITCH,
+    kPXP_Shadow_OUT_LRC,
+    kPXP_Shadow_OUT_PS_ULC,
+    kPXP_Shadow_OUT_PS_LRC,
+    kPXP_Shadow_OUT_AS_ULC,
+    kPXP_Shadow_OUT_AS_LRC,
+    kPXP_Shadow_PS_BUF,
+    kPXP_Shadow_PS_UBUF,
+    kPXP_Shadow_PS_VBUF,
+    kPXP_Shadow_PS_PITCH,
+    kPXP_Shadow_PS_SCALE,
+    kPXP_Shadow_PS_CLRKEYLOW,
+    kPXP_Shadow_PS_CLRKEYHIGH,
+    kPXP_Shadow_AS_BUF,
+    kPXP_Shadow_AS_PITCH,
+    kPXP_Shadow_AS_CLRKEYLOW,
+    kPXP_Shadow_AS_CLRKEYHIGH,
+    kPXP_Shadow_PORTER_DUFF_CTRL,
+    kPXP_ShadowRegCount,
+};
+
+/* Write a register through the shadow. */
+#define PXP_WRITE_REG(base, reg, value) PXP_WriteShadowReg((base), (uint32_t)kPXP_Shadow_##reg, &(base)->reg, (value))
+
+/* Write a read-modify-write register if the value is changed. */
+#define PXP_UPDATE_REG(base, reg, oldValue, value) PXP_UpdateReg((base), &(base)->reg, (oldValue), (value))
+#else
+#define PXP_WRITE_REG(base, reg, value)            ((base)->reg = (value))
+#define PXP_UPDATE_REG(base, reg, oldValue, value) ((void)(oldValue), (base)->reg = (value))
+#endif /* PXP_USE_SHADOW_REGISTER */
+
 #if !(defined(FSL_FEATURE_PXP_HAS_NO_PORTER_DUFF_CTRL) && FSL_FEATURE_PXP_HAS_NO_PORTER_DUFF_CTRL)
 #define S1_COLOR_MODE           PXP_PORTER_DUFF_CTRL_S1_COLOR_MODE
 #define S1_ALPHA_MODE           PXP_PORTER_DUFF_CTRL_S1_ALPHA_MODE
@@ -88,6 +125,15 @@ typedef union _pxp_pvoid_u32
     uint32_t u32;
 } pxp_pvoid_u32_t;
 
+#if PXP_USE_SHADOW_REGISTER
+typedef struct _pxp_shadow
+{
+    uint32_t value[kPXP_ShadowRegCount]; /* Last written value. */
+    uint32_t validMask;                  /* Bit n set if value[n] is the register value. */
+    pxp_shadow_stat_t stat;
+} pxp_shadow_t;
+#endif /* PXP_USE_SHADOW_REGISTER */
+
 /*******************************************************************************
  * Prototypes
  ******************************************************************************/
@@ -153,12 +199,55 @@ static void PXP_StartRectCopy(PXP_Type *base,
                               uint16_t height,
                               pxp_as_pixel_format_t pixelFormat);
 
+/*!
+ * @brief Prepare the PXP for an operation started by this driver.
+ *
+ * The interrupt enable is kept, the other control settings are reset.
+ *
+ * @param base PXP peripheral base address.
+ */
+static void PXP_ResetOperation(PXP_Type *base);
+
+/*!
+ * @brief Get the CTRL bits enabling the process engines in primary processing flow.
+ *
+ * @return The engine enable bits set by PXP_ResetControl.
+ */
+static uint32_t PXP_GetEngineEnableMask(void);
+
+#if PXP_USE_SHADOW_REGISTER
+/*!
+ * @brief Write a register if its value is not known to be the same.
+ *
+ * @param base PXP peripheral base address.
+ * @param reg Shadow index of the register.
+ * @param addr Register address.
+ * @param value Value to write.
+ */
+static void PXP_WriteShadowReg(PXP_Type *base, uint32_t reg, volatile uint32_t *addr, uint32_t value);
+
+/*!
+ * @brief Write a read-modify-write register if the value is changed.
+ *
+ * @param base PXP peripheral base address.
+ * @param addr Register address.
+ * @param oldValue Value read from the register.
+ * @param value Value to write.
+ */
+static void PXP_UpdateReg(PXP_Type *base, volatile uint32_t *addr, uint32_t oldValue, uint32_t value);
+#endif /* PXP_USE_SHADOW_REGISTER */
+
 /*******************************************************************************
  * Variables
  ******************************************************************************/
 /*! @brief Pointers to PXP bases for each instance. */
 static PXP_Type *const s_pxpBases[] = PXP_BASE_PTRS;
 
+#if PXP_USE_SHADOW_REGISTER
+/*! @brief Shadow registers for each instance. */
+static pxp_shadow_t s_pxpShadow[ARRAY_SIZE(s_pxpBases)];
+#endif /* PXP_USE_SHADOW_REGISTER */
+
 #if !(defined(FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL) && FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL)
 /*! @brief Pointers to PXP clocks for each PXP submodule. */
 static const clock_ip_name_t s_pxpClocks[] = PXP_CLOCKS;
@@ -276,10 +365,15 @@ static void PXP_GetScalerParam(uint16_t inputDimension, uint16_t outputDimension
  */
 void PXP_ResetControl(PXP_Type *base)
 {
-    uint32_t ctrl = 0U;
-
     PXP_Reset(base);
 
+    base->CTRL = PXP_GetEngineEnableMask();
+}
+
+static uint32_t PXP_GetEngineEnableMask(void)
+{
+    uint32_t ctrl = 0U;
+
 /* Enable the process engine in primary processing flow. */
 #if defined(PXP_CTRL_ENABLE_ROTATE0_MASK)
     ctrl |= PXP_CTRL_ENABLE_ROTATE0_MASK;
@@ -297,7 +391,7 @@ void PXP_ResetControl(PXP_Type *base)
     ctrl |= PXP_CTRL_ENABLE_PS_AS_OUT_MASK;
 #endif
 
-    base->CTRL = ctrl;
+    return ctrl;
 }
 
 /*!
@@ -351,7 +445,81 @@ void PXP_Reset(PXP_Type *base)
 {
     base->CTRL_SET = PXP_CTRL_SFTRST_MASK;
     base->CTRL_CLR = (PXP_CTRL_SFTRST_MASK | PXP_CTRL_CLKGATE_MASK);
+
+#if PXP_USE_SHADOW_REGISTER
+    PXP_InvalidateShadow(base);
+#endif
+}
+
+#if PXP_USE_SHADOW_REGISTER
+static void PXP_WriteShadowReg(PXP_Type *base, uint32_t reg, volatile uint32_t *addr, uint32_t value)
+{
+    pxp_shadow_t *shadow = &s_pxpShadow[PXP_GetInstance(base)];
+
+    if ((0U != (shadow->validMask & (1UL << reg))) && (shadow->value[reg] == value))
+    {
+        shadow->stat.skipped++;
+    }
+    else
+    {
+        *addr              = value;
+        shadow->value[reg] = value;
+        shadow->validMask |= (1UL << reg);
+        shadow->stat.written++;
+    }
+}
+
+static void PXP_UpdateReg(PXP_Type *base, volatile uint32_t *addr, uint32_t oldValue, uint32_t value)
+{
+    pxp_shadow_t *shadow = &s_pxpShadow[PXP_GetInstance(base)];
+
+    if (oldValue == value)
+    {
+        shadow->stat.skipped++;
+    }
+    else
+    {
+        *addr = value;
+        shadow->stat.written++;
+    }
+}
+
+/*!
+ * brief Get the configuration register write counters.
+ *
+ * param base PXP peripheral base address.
+ * param stat Pointer to the counters.
+ */
+void PXP_GetShadowStat(PXP_Type *base, pxp_shadow_stat_t *stat)
+{
+    assert(NULL != stat);
+
+    *stat = s_pxpShadow[PXP_GetInstance(base)].stat;
+}
+
+/*!
+ * brief Clear the configuration register write counters.
+ *
+ * param base PXP peripheral base address.
+ */
+void PXP_ClearShadowStat(PXP_Type *base)
+{
+    pxp_shadow_t *shadow = &s_pxpShadow[PXP_GetInstance(base)];
+
+    shadow->stat.written = 0U;
+    shadow->stat.skipped = 0U;
+}
+
+/*!
+ * brief Forget the register values kept by the driver.
+ *
+ * param base PXP peripheral base address.
+ */
+void PXP_InvalidateShadow(PXP_Type *base)
+{
+    s_pxpShadow[PXP_GetInstance(base)].validMask = 0U;
 }
+#endif /* PXP_USE_SHADOW_REGISTER */
 
 /*!
  * brief Set the alpha surface input buffer configuration.
@@ -363,10 +531,13 @@ void PXP_SetAlphaSurfaceBufferConfig(PXP_Type *base, const pxp_as_buffer_config_
 {
     assert(NULL != config);
 
-    base->AS_CTRL = (base->AS_CTRL & ~PXP_AS_CTRL_FORMAT_MASK) | PXP_AS_CTRL_FORMAT(config->pixelFormat);
+    uint32_t asCtrl = base->AS_CTRL;
+
+    PXP_UPDATE_REG(base, AS_CTRL, asCtrl,
+                   (asCtrl & ~PXP_AS_CTRL_FORMAT_MASK) | PXP_AS_CTRL_FORMAT(config->pixelFormat));
 
-    base->AS_BUF   = PXP_ADDR_CPU_2_IP(config->bufferAddr);
-    base->AS_PITCH = config->pitchBytes;
+    PXP_WRITE_REG(base, AS_BUF, PXP_ADDR_CPU_2_IP(config->bufferAddr));
+    PXP_WRITE_REG(base, AS_PITCH, config->pitchBytes);
 }
 
 /*!
@@ -378,9 +549,11 @@ void PXP_SetAlphaSurfaceBufferConfig(PXP_Type *base, const pxp_as_buffer_config_
 void PXP_SetAlphaSurfaceBlendConfig(PXP_Type *base, const pxp_as_blend_config_t *config)
 {
     assert(NULL != config);
+    uint32_t asCtrl;
     uint32_t reg;
 
-    reg = base->AS_CTRL;
+    asCtrl = base->AS_CTRL;
+    reg    = asCtrl;
     reg &=
         ~(PXP_AS_CTRL_ALPHA0_INVERT_MASK | PXP_AS_CTRL_ROP_MASK | PXP_AS_CTRL_ALPHA_MASK | PXP_AS_CTRL_ALPHA_CTRL_MASK);
     reg |= (PXP_AS_CTRL_ROP(config->ropMode) | PXP_AS_CTRL_ALPHA(config->alpha) |
@@ -391,7 +564,7 @@ void PXP_SetAlphaSurfaceBlendConfig(PXP_Type *base, const pxp_as_blend_config_t
         reg |= PXP_AS_CTRL_ALPHA0_INVERT_MASK;
     }
 
-    base->AS_CTRL = reg;
+    PXP_UPDATE_REG(base, AS_CTRL, asCtrl, reg);
 }
 
 #if defined(FSL_FEATURE_PXP_V3) && FSL_FEATURE_PXP_V3
@@ -432,8 +605,8 @@ void PXP_SetAlphaSurfaceBlendSecondaryConfig(PXP_Type *base, const pxp_as_blend_
 void PXP_SetAlphaSurfacePosition(
     PXP_Type *base, uint16_t upperLeftX, uint16_t upperLeftY, uint16_t lowerRightX, uint16_t lowerRightY)
 {
-    base->OUT_AS_ULC = PXP_OUT_AS_ULC_Y(upperLeftY) | PXP_OUT_AS_ULC_X(upperLeftX);
-    base->OUT_AS_LRC = PXP_OUT_AS_LRC_Y(lowerRightY) | PXP_OUT_AS_LRC_X(lowerRightX);
+    PXP_WRITE_REG(base, OUT_AS_ULC, PXP_OUT_AS_ULC_Y(upperLeftY) | PXP_OUT_AS_ULC_X(upperLeftX));
+    PXP_WRITE_REG(base, OUT_AS_LRC, PXP_OUT_AS_LRC_Y(lowerRightY) | PXP_OUT_AS_LRC_X(lowerRightX));
 }
 
 #if defined(FSL_FEATURE_PXP_V3) && FSL_FEATURE_PXP_V3
@@ -489,8 +662,8 @@ void PXP_SetAlphaSurfaceOverlayColorKey(PXP_Type *base, uint8_t num, uint32_t co
  */
 void PXP_SetAlphaSurfaceOverlayColorKey(PXP_Type *base, uint32_t colorKeyLow, uint32_t colorKeyHigh)
 {
-    base->AS_CLRKEYLOW  = colorKeyLow;
-    base->AS_CLRKEYHIGH = colorKeyHigh;
+    PXP_WRITE_REG(base, AS_CLRKEYLOW, colorKeyLow);
+    PXP_WRITE_REG(base, AS_CLRKEYHIGH, colorKeyHigh);
 }
 #endif /* FSL_FEATURE_PXP_V3 */
 
@@ -504,13 +677,16 @@ void PXP_SetProcessSurfaceBufferConfig(PXP_Type *base, const pxp_ps_buffer_confi
 {
     assert(NULL != config);
 
-    base->PS_CTRL = ((base->PS_CTRL & ~(PXP_PS_CTRL_FORMAT_MASK | PXP_PS_CTRL_WB_SWAP_MASK)) |
-                     PXP_PS_CTRL_FORMAT(config->pixelFormat) | PXP_PS_CTRL_WB_SWAP(config->swapByte));
+    uint32_t psCtrl = base->PS_CTRL;
 
-    base->PS_BUF   = PXP_ADDR_CPU_2_IP(config->bufferAddr);
-    base->PS_UBUF  = PXP_ADDR_CPU_2_IP(config->bufferAddrU);
-    base->PS_VBUF  = PXP_ADDR_CPU_2_IP(config->bufferAddrV);
-    base->PS_PITCH = config->pitchBytes;
+    PXP_UPDATE_REG(base, PS_CTRL, psCtrl,
+                   ((psCtrl & ~(PXP_PS_CTRL_FORMAT_MASK | PXP_PS_CTRL_WB_SWAP_MASK)) |
+                    PXP_PS_CTRL_FORMAT(config->pixelFormat) | PXP_PS_CTRL_WB_SWAP(config->swapByte)));
+
+    PXP_WRITE_REG(base, PS_BUF, PXP_ADDR_CPU_2_IP(config->bufferAddr));
+    PXP_WRITE_REG(base, PS_UBUF, PXP_ADDR_CPU_2_IP(config->bufferAddrU));
+    PXP_WRITE_REG(base, PS_VBUF, PXP_ADDR_CPU_2_IP(config->bufferAddrV));
+    PXP_WRITE_REG(base, PS_PITCH, config->pitchBytes);
 }
 
 /*!
@@ -527,16 +703,45 @@ void PXP_SetProcessSurfaceBufferConfig(PXP_Type *base, const pxp_ps_buffer_confi
 void PXP_SetProcessSurfaceScaler(
     PXP_Type *base, uint16_t inputWidth, uint16_t inputHeight, uint16_t outputWidth, uint16_t outputHeight)
 {
-    uint8_t decX, decY;
-    uint32_t scaleX, scaleY;
+    pxp_ps_scaler_config_t config;
+    uint32_t psCtrl;
 
-    PXP_GetScalerParam(inputWidth, outputWidth, &decX, &scaleX);
-    PXP_GetScalerParam(inputHeight, outputHeight, &decY, &scaleY);
+    PXP_GetProcessSurfaceScalerConfig(inputWidth, inputHeight, outputWidth, outputHeight, &config);
 
-    base->PS_CTRL = (base->PS_CTRL & ~(PXP_PS_CTRL_DECX_MASK | PXP_PS_CTRL_DECY_MASK)) | PXP_PS_CTRL_DECX(decX) |
-                    PXP_PS_CTRL_DECY(decY);
+    psCtrl = base->PS_CTRL;
 
-    base->PS_SCALE = PXP_PS_SCALE_XSCALE(scaleX) | PXP_PS_SCALE_YSCALE(scaleY);
+    PXP_UPDATE_REG(base, PS_CTRL, psCtrl,
+                   (psCtrl & ~(PXP_PS_CTRL_DECX_MASK | PXP_PS_CTRL_DECY_MASK)) | PXP_PS_CTRL_DECX(config.decX) |
+                       PXP_PS_CTRL_DECY(config.decY));
+
+    PXP_WRITE_REG(base, PS_SCALE, PXP_PS_SCALE_XSCALE(config.scaleX) | PXP_PS_SCALE_YSCALE(config.scaleY));
+}
+
+/*!
+ * brief Get the process surface scaler configuration without writing the registers.
+ *
+ * The result is what ref PXP_SetProcessSurfaceScaler programs, it could be
+ * saved and set later, for example in a command for ref PXP_SetNextCommand.
+ *
+ * param inputWidth Input image width.
+ * param inputHeight Input image height.
+ * param outputWidth Output image width.
+ * param outputHeight Output image height.
+ * param config Pointer to the scaler configuration.
+ */
+void PXP_GetProcessSurfaceScalerConfig(uint16_t inputWidth,
+                                       uint16_t inputHeight,
+                                       uint16_t outputWidth,
+                                       uint16_t outputHeight,
+                                       pxp_ps_scaler_config_t *config)
+{
+    uint32_t scaleX, scaleY;
+
+    PXP_GetScalerParam(inputWidth, outputWidth, &config->decX, &scaleX);
+    PXP_GetScalerParam(inputHeight, outputHeight, &config->decY, &scaleY);
+
+    config->scaleX = (uint16_t)scaleX;
+    config->scaleY = (uint16_t)scaleY;
 }
 
 /*!
@@ -551,8 +756,8 @@ void PXP_SetProcessSurfaceScaler(
 void PXP_SetProcessSurfacePosition(
     PXP_Type *base, uint16_t upperLeftX, uint16_t upperLeftY, uint16_t lowerRightX, uint16_t lowerRightY)
 {
-    base->OUT_PS_ULC = PXP_OUT_PS_ULC_Y(upperLeftY) | PXP_OUT_PS_ULC_X(upperLeftX);
-    base->OUT_PS_LRC = PXP_OUT_PS_LRC_Y(lowerRightY) | PXP_OUT_PS_LRC_X(lowerRightX);
+    PXP_WRITE_REG(base, OUT_PS_ULC, PXP_OUT_PS_ULC_Y(upperLeftY) | PXP_OUT_PS_ULC_X(upperLeftX));
+    PXP_WRITE_REG(base, OUT_PS_LRC, PXP_OUT_PS_LRC_Y(lowerRightY) | PXP_OUT_PS_LRC_X(lowerRightX));
 }
 
 #if defined(FSL_FEATURE_PXP_V3) && FSL_FEATURE_PXP_V3
@@ -600,8 +805,8 @@ void PXP_SetProcessSurfaceColorKey(PXP_Type *base, uint8_t num, uint32_t colorKe
  */
 void PXP_SetProcessSurfaceColorKey(PXP_Type *base, uint32_t colorKeyLow, uint32_t colorKeyHigh)
 {
-    base->PS_CLRKEYLOW  = colorKeyLow;
-    base->PS_CLRKEYHIGH = colorKeyHigh;
+    PXP_WRITE_REG(base, PS_CLRKEYLOW, colorKeyLow);
+    PXP_WRITE_REG(base, PS_CLRKEYHIGH, colorKeyHigh);
 }
 #endif /* FSL_FEATURE_PXP_V3 */
 
@@ -615,14 +820,19 @@ void PXP_SetOutputBufferConfig(PXP_Type *base, const pxp_output_buffer_config_t
 {
     assert(NULL != config);
 
-    base->OUT_CTRL = (base->OUT_CTRL & ~(PXP_OUT_CTRL_FORMAT_MASK | PXP_OUT_CTRL_INTERLACED_OUTPUT_MASK)) |
-                     PXP_OUT_CTRL_FORMAT(config->pixelFormat) | PXP_OUT_CTRL_INTERLACED_OUTPUT(config->interlacedMode);
+    uint32_t outCtrl = base->OUT_CTRL;
 
-    base->OUT_BUF  = PXP_ADDR_CPU_2_IP(config->buffer0Addr);
-    base->OUT_BUF2 = PXP_ADDR_CPU_2_IP(config->buffer1Addr);
+    PXP_UPDATE_REG(base, OUT_CTRL, outCtrl,
+                   (outCtrl & ~(PXP_OUT_CTRL_FORMAT_MASK | PXP_OUT_CTRL_INTERLACED_OUTPUT_MASK)) |
+                       PXP_OUT_CTRL_FORMAT(config->pixelFormat) |
+                       PXP_OUT_CTRL_INTERLACED_OUTPUT(config->interlacedMode));
 
-    base->OUT_PITCH = config->pitchBytes;
-    base->OUT_LRC   = PXP_OUT_LRC_Y((uint32_t)config->height - 1U) | PXP_OUT_LRC_X((uint32_t)config->width - 1U);
+    PXP_WRITE_REG(base, OUT_BUF, PXP_ADDR_CPU_2_IP(config->buffer0Addr));
+    PXP_WRITE_REG(base, OUT_BUF2, PXP_ADDR_CPU_2_IP(config->buffer1Addr));
+
+    PXP_WRITE_REG(base, OUT_PITCH, config->pitchBytes);
+    PXP_WRITE_REG(base, OUT_LRC,
+                  PXP_OUT_LRC_Y((uint32_t)config->height - 1U) | PXP_OUT_LRC_X((uint32_t)config->width - 1U));
 
 /*
  * The dither store size must be set to the same with the output buffer size,
@@ -756,6 +966,11 @@ void PXP_SetNextCommand(PXP_Type *base, void *commandAddr)
     addr.pvoid = commandAddr;
 
     base->NEXT = PXP_ADDR_CPU_2_IP(addr.u32) & PXP_NEXT_POINTER_MASK;
+
+#if PXP_USE_SHADOW_REGISTER
+    /* The registers are loaded from the command. */
+    PXP_InvalidateShadow(base);
+#endif
 }
 
 #if !(defined(FSL_FEATURE_PXP_HAS_NO_CSC2) && FSL_FEATURE_PXP_HAS_NO_CSC2)
@@ -1068,7 +1283,7 @@ void PXP_SetPorterDuffConfig(PXP_Type *base, const pxp_porter_duff_config_t *con
 
     pdConfig.pdConfigStruct = *config;
 
-    base->PORTER_DUFF_CTRL = pdConfig.u32;
+    PXP_WRITE_REG(base, PORTER_DUFF_CTRL, pdConfig.u32);
 }
 #endif /* FSL_FEATURE_PXP_HAS_NO_PORTER_DUFF_CTRL */
 
@@ -1190,17 +1405,8 @@ status_t PXP_GetPorterDuffConfigExt(pxp_porter_duff_blend_mode_t mode,
 }
 #endif /* FSL_FEATURE_PXP_V3 || FSL_FEATURE_PXP_HAS_NO_PORTER_DUFF_CTRL  */
 
-static void PXP_StartRectCopy(PXP_Type *base,
-                              uint32_t srcAddr,
-                              uint16_t srcPitchBytes,
-                              uint32_t destAddr,
-                              uint16_t destPitchBytes,
-                              uint16_t width,
-                              uint16_t height,
-                              pxp_as_pixel_format_t pixelFormat)
+static void PXP_ResetOperation(PXP_Type *base)
 {
-    pxp_output_buffer_config_t outputBufferConfig;
-    pxp_as_buffer_config_t asBufferConfig;
     uint32_t intMask;
 
 #if !(defined(FSL_FEATURE_PXP_HAS_NO_LUT) && FSL_FEATURE_PXP_HAS_NO_LUT)
@@ -1210,10 +1416,47 @@ static void PXP_StartRectCopy(PXP_Type *base,
     intMask = base->CTRL & (PXP_CTRL_NEXT_IRQ_ENABLE_MASK | PXP_CTRL_IRQ_ENABLE_MASK);
 #endif
 
+#if PXP_USE_SHADOW_REGISTER
+    uint32_t asCtrl  = base->AS_CTRL;
+    uint32_t outCtrl = base->OUT_CTRL;
+
+    /*
+     * No soft reset, the registers of the previous operation are kept, so the
+     * ones not changed are not written again. The operations program all the
+     * registers they use, except these which are set to the value left by
+     * PXP_ResetControl here. The PS background is used by the copy as the
+     * disabled PS color, it is ORed into the output by the ROP.
+     */
+    base->CTRL = PXP_GetEngineEnableMask() | intMask;
+
+    PXP_SetProcessSurfaceBackGroundColor(base, 0U);
+
+    PXP_UPDATE_REG(base, AS_CTRL, asCtrl, asCtrl & ~PXP_AS_CTRL_ENABLE_COLORKEY_MASK);
+    PXP_UPDATE_REG(base, OUT_CTRL, outCtrl, outCtrl & ~(PXP_OUT_CTRL_ALPHA_MASK | PXP_OUT_CTRL_ALPHA_OUTPUT_MASK));
+#if !(defined(FSL_FEATURE_PXP_HAS_NO_PORTER_DUFF_CTRL) && FSL_FEATURE_PXP_HAS_NO_PORTER_DUFF_CTRL)
+    PXP_WRITE_REG(base, PORTER_DUFF_CTRL, 0U);
+#endif
+#else
     PXP_ResetControl(base);
 
     /* Restore previous interrupt configuration. */
     PXP_EnableInterrupts(base, intMask);
+#endif /* PXP_USE_SHADOW_REGISTER */
+}
+
+static void PXP_StartRectCopy(PXP_Type *base,
+                              uint32_t srcAddr,
+                              uint16_t srcPitchBytes,
+                              uint32_t destAddr,
+                              uint16_t destPitchBytes,
+                              uint16_t width,
+                              uint16_t height,
+                              pxp_as_pixel_format_t pixelFormat)
+{
+    pxp_output_buffer_config_t outputBufferConfig;
+    pxp_as_buffer_config_t asBufferConfig;
+
+    PXP_ResetOperation(base);
 
     /* Disable PS */
     PXP_SetProcessSurfacePosition(base, 0xFFFFU, 0xFFFFU, 0U, 0U);
@@ -1398,6 +1641,113 @@ status_t PXP_MemCopy(PXP_Type *base, uint32_t srcAddr, uint32_t destAddr, uint32
     return kStatus_Success;
 }
 
+/*!
+ * brief Start filling a rectangle with solid color.
+ *
+ * param base PXP peripheral base address.
+ * param config Pointer to the fill configuration structure.
+ * retval kStatus_Success Successfully started the fill process.
+ * retval kStatus_InvalidArgument Invalid argument.
+ */
+status_t PXP_StartFill(PXP_Type *base, const pxp_fill_config_t *config)
+{
+    pxp_output_buffer_config_t outputBufferConfig;
+    uint8_t bytePerPixel;
+    uint32_t destAddr;
+
+    if ((0U == config->height) || (0U == config->width))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    if ((config->pixelFormat == kPXP_OutputPixelFormatARGB8888) ||
+        (config->pixelFormat == kPXP_OutputPixelFormatRGB888))
+    {
+        bytePerPixel = 4U;
+    }
+    else if (config->pixelFormat == kPXP_OutputPixelFormatRGB565)
+    {
+        bytePerPixel = 2U;
+    }
+    else
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    destAddr = config->destPicBaseAddr + ((uint32_t)config->destOffsetY * (uint32_t)config->destPitchBytes) +
+               bytePerPixel * config->destOffsetX;
+
+    PXP_ResetOperation(base);
+
+    /* Zero size PS, the output pixels are all PS background color. */
+#if defined(FSL_FEATURE_PXP_V3) && FSL_FEATURE_PXP_V3
+    PXP_SetProcessSurfaceBackGroundColor(base, 0U, config->color);
+#else
+    PXP_SetProcessSurfaceBackGroundColor(base, config->color);
+#endif
+    PXP_SetProcessSurfacePosition(base, 0xFFFFU, 0xFFFFU, 0U, 0U);
+
+    if (config->pixelFormat == kPXP_OutputPixelFormatARGB8888)
+    {
+        /* The background color has no alpha, set the alpha by AS with all pixels color keyed. */
+        pxp_as_buffer_config_t asBufferConfig = {
+            .pixelFormat = kPXP_AsPixelFormatARGB8888,
+            .bufferAddr  = destAddr,
+            .pitchBytes  = config->destPitchBytes,
+        };
+        PXP_SetAlphaSurfaceBufferConfig(base, &asBufferConfig);
+
+        pxp_as_blend_config_t asBlendConfig = {.alpha       = (uint8_t)(config->color >> 24U),
+                                               .invertAlpha = false,
+                                               .alphaMode   = kPXP_AlphaOverride,
+                                               .ropMode     = kPXP_RopMergeAs};
+        PXP_SetAlphaSurfaceBlendConfig(base, &asBlendConfig);
+#if defined(FSL_FEATURE_PXP_V3) && FSL_FEATURE_PXP_V3
+        PXP_SetAlphaSurfaceOverlayColorKey(base, 0U, 0U, 0xFFFFFFFFUL);
+        PXP_EnableAlphaSurfaceOverlayColorKey(base, 0U, true);
+#else
+        PXP_SetAlphaSurfaceOverlayColorKey(base, 0U, 0xFFFFFFFFUL);
+        PXP_EnableAlphaSurfaceOverlayColorKey(base, true);
+#endif
+        PXP_SetAlphaSurfacePosition(base, 0U, 0U, config->width - 1U, config->height - 1U);
+    }
+    else
+    {
+        /* Disable AS */
+        PXP_SetAlphaSurfacePosition(base, 0xFFFFU, 0xFFFFU, 0U, 0U);
+    }
+
+    /* Output buffer. */
+    outputBufferConfig.pixelFormat    = config->pixelFormat;
+    outputBufferConfig.interlacedMode = kPXP_OutputProgressive;
+    outputBufferConfig.buffer0Addr    = destAddr;
+    outputBufferConfig.buffer1Addr    = 0U;
+    outputBufferConfig.pitchBytes     = config->destPitchBytes;
+    outputBufferConfig.width          = config->width;
+    outputBufferConfig.height         = config->height;
+
+    PXP_SetOutputBufferConfig(base, &outputBufferConfig);
+
+    PXP_EnableCsc1(base, false);
+
+#if defined(FSL_FEATURE_PXP_V3) && FSL_FEATURE_PXP_V3
+    PXP_SetPath(base, kPXP_Mux3SelectCsc1Engine);
+    PXP_SetPath(base, kPXP_Mux8SelectAlphaBlending0);
+    PXP_SetPath(base, kPXP_Mux11SelectMux8);
+    PXP_SetPath(base, kPXP_Mux14SelectMux11);
+    PXP_SetPath(base, kPXP_Mux0SelectNone);
+    PXP_SetPath(base, kPXP_Mux6SelectNone);
+    PXP_SetPath(base, kPXP_Mux9SelectNone);
+    PXP_SetPath(base, kPXP_Mux12SelectNone);
+#endif
+
+    PXP_ClearStatusFlags(base, (uint32_t)kPXP_CompleteFlag);
+
+    PXP_Start(base);
+
+    return kStatus_Success;
+}
+
 #if defined(FSL_FEATURE_PXP_V3) && FSL_FEATURE_PXP_V3
 
 /*!
@@ -51,6 +51,21 @@
 #define FSL_PXP_DRIVER_VERSION (MAKE_VERSION(2, 6, 1))
 /*! @} */
 
+/*
+ * Keep the last value written to the PXP configuration registers. The driver
+ * doesn't write a register with the value it already has, and the copy and fill
+ * functions don't soft reset the PXP, so the configuration not changed between
+ * operations is not written again. Not supported by PXP V3.
+ */
+#if defined(FSL_FEATURE_PXP_V3) && FSL_FEATURE_PXP_V3
+#undef PXP_USE_SHADOW_REGISTER
+#define PXP_USE_SHADOW_REGISTER 0
+#endif
+
+#ifndef PXP_USE_SHADOW_REGISTER
+#define PXP_USE_SHADOW_REGISTER 1
+#endif
+
 /* This macto indicates whether the rotate sub module is shared by process surface and output buffer. */
 #if defined(PXP_CTRL_ROT_POS_MASK)
 #define PXP_SHARE_ROTATE 1
@@ -394,6 +409,15 @@ typedef struct _pxp_ps_buffer_config
     uint16_t pitchBytes;               /*!< Number of bytes between two vertically adjacent pixels. */
 } pxp_ps_buffer_config_t;
 
+/*! @brief PXP process surface scaler configuration, see @ref PXP_GetProcessSurfaceScalerConfig. */
+typedef struct _pxp_ps_scaler_config
+{
+    uint8_t decX;    /*!< Horizontal decimation, every 2^decX input pixels are averaged. */
+    uint8_t decY;    /*!< Vertical decimation, every 2^decY input lines are averaged. */
+    uint16_t scaleX; /*!< Horizontal scale fact after decimation, in 1/4096. */
+    uint16_t scaleY; /*!< Vertical scale fact after decimation, in 1/4096. */
+} pxp_ps_scaler_config_t;
+
 /*! @brief PXP alpha surface buffer pixel format. */
 typedef enum _pxp_as_pixel_format
 {
@@ -753,6 +777,28 @@ typedef struct _pxp_pic_copy_config
     pxp_as_pixel_format_t pixelFormat; /*!< Buffer pixel format. */
 } pxp_pic_copy_config_t;
 
+/*! @brief PXP solid color fill configuration. */
+typedef struct _pxp_fill_config
+{
+    uint32_t destPicBaseAddr;              /*!< Destination picture base address. */
+    uint16_t destPitchBytes;               /*!< Pitch of the destination buffer. */
+    uint16_t destOffsetX;                  /*!< Fill position in destination picture. */
+    uint16_t destOffsetY;                  /*!< Fill position in destination picture. */
+    uint16_t width;                        /*!< Pixel number each line to fill. */
+    uint16_t height;                       /*!< Lines to fill. */
+    uint32_t color;                        /*!< Fill color in ARGB8888 format. */
+    pxp_output_pixel_format_t pixelFormat; /*!< Buffer pixel format, ARGB8888, RGB888 or RGB565. */
+} pxp_fill_config_t;
+
+#if PXP_USE_SHADOW_REGISTER
+/*! @brief Configuration register write counters. */
+typedef struct _pxp_shadow_stat
+{
+    uint32_t written; /*!< Register writes issued. */
+    uint32_t skipped; /*!< Register writes skipped because the value is not changed. */
+} pxp_shadow_stat_t;
+#endif /* PXP_USE_SHADOW_REGISTER */
+
 #if defined(FSL_FEATURE_PXP_V3) && FSL_FEATURE_PXP_V3
 
 /*!
@@ -1586,6 +1632,24 @@ void PXP_SetProcessSurfaceBufferConfig(PXP_Type *base, const pxp_ps_buffer_confi
 void PXP_SetProcessSurfaceScaler(
     PXP_Type *base, uint16_t inputWidth, uint16_t inputHeight, uint16_t outputWidth, uint16_t outputHeight);
 
+/*!
+ * @brief Get the process surface scaler configuration without writing the registers.
+ *
+ * The result is what @ref PXP_SetProcessSurfaceScaler programs, it could be
+ * saved and set later, for example in a command for @ref PXP_SetNextCommand.
+ *
+ * @param inputWidth Input image width.
+ * @param inputHeight Input image height.
+ * @param outputWidth Output image width.
+ * @param outputHeight Output image height.
+ * @param config Pointer to the scaler configuration.
+ */
+void PXP_GetProcessSurfaceScalerConfig(uint16_t inputWidth,
+                                       uint16_t inputHeight,
+                                       uint16_t outputWidth,
+                                       uint16_t outputHeight,
+                                       pxp_ps_scaler_config_t *config);
+
 /*!
  * @brief Set the process surface position in output buffer.
  *
@@ -1845,6 +1909,41 @@ static inline void PXP_CancelNextCommand(PXP_Type *base)
 
 /*! @} */
 
+#if PXP_USE_SHADOW_REGISTER
+/*!
+ * @name Shadow registers
+ * @{
+ */
+
+/*!
+ * @brief Get the configuration register write counters.
+ *
+ * @param base PXP peripheral base address.
+ * @param stat Pointer to the counters.
+ */
+void PXP_GetShadowStat(PXP_Type *base, pxp_shadow_stat_t *stat);
+
+/*!
+ * @brief Clear the configuration register write counters.
+ *
+ * @param base PXP peripheral base address.
+ */
+void PXP_ClearShadowStat(PXP_Type *base);
+
+/*!
+ * @brief Forget the register values kept by the driver.
+ *
+ * Call this function after the configuration registers are written without
+ * this driver, then the next writes are not skipped. The driver calls it in
+ * @ref PXP_Reset and @ref PXP_SetNextCommand.
+ *
+ * @param base PXP peripheral base address.
+ */
+void PXP_InvalidateShadow(PXP_Type *base);
+
+/*! @} */
+#endif /* PXP_USE_SHADOW_REGISTER */
+
 /*!
  * @name Color space conversion
  * @{
@@ -2255,6 +2354,24 @@ status_t PXP_StartMemCopy(PXP_Type *base, uint32_t srcAddr, uint32_t destAddr, u
  */
 status_t PXP_MemCopy(PXP_Type *base, uint32_t srcAddr, uint32_t destAddr, uint32_t size);
 
+/*!
+ * @brief Start filling a rectangle with solid color.
+ *
+ * No input surface is used, all output pixels get the process surface
+ * background color. Different from @ref PXP_BuildRect, this function returns
+ * after the PXP is started, upper layer waits for @ref kPXP_CompleteFlag or the
+ * completion interrupt. The interrupt enable status is kept.
+ *
+ * @note This function resets the old PXP settings, which means the settings
+ * like rotate, flip, will be reseted to disabled status.
+ *
+ * @param base PXP peripheral base address.
+ * @param config Pointer to the fill configuration structure.
+ * @retval kStatus_Success Successfully started the fill process.
+ * @retval kStatus_InvalidArgument Invalid argument.
+ */
+status_t PXP_StartFill(PXP_Type *base, const pxp_fill_config_t *config);
+
 /*! @} */
 
 #if defined(FSL_FEATURE_PXP_V3) && FSL_FEATURE_PXP_V3
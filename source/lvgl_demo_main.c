@@ -67,7 +67,7 @@ static void AppTask(void *param)
     for (;;)
     {
         uint32_t idle = lv_task_handler();
-        vTaskDelay(idle);
+        lv_port_sched_wait(idle);
     }
 }
 
@@ -0,0 +1,138 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "rotate_support.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* The panel is 720x1280, LVGL renders the rotated 1280x720 frame. */
+#define DEMO_BUFFER_WIDTH  720U
+#define DEMO_BUFFER_HEIGHT 1280U
+#define LVGL_BUFFER_WIDTH  DEMO_BUFFER_HEIGHT
+#define LVGL_BUFFER_HEIGHT DEMO_BUFFER_WIDTH
+
+#define BENCH_REPEAT 20U
+
+/*
+ * The per pixel loop DEMO_FlushDisplay used before the tiled rotation. It writes
+ * one row past the frame buffer end, so the buffers have one spare row.
+ */
+#define BENCH_OLD_LOOP(type, dest, src)                                                                           \
+    for (uint32_t y = 0; y < LVGL_BUFFER_HEIGHT; y++)                                                             \
+    {                                                                                                             \
+        for (uint32_t x = 0; x < LVGL_BUFFER_WIDTH; x++)                                                          \
+        {                                                                                                         \
+            ((type *)(dest))[(DEMO_BUFFER_HEIGHT - x) * DEMO_BUFFER_WIDTH + y] = ((const type *)(src))[y * LVGL_BUFFER_WIDTH + x]; \
+        }                                                                                                         \
+    }
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static uint64_t BENCH_GetNs(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint64_t)now.tv_sec * 1000000000U + (uint64_t)now.tv_nsec;
+}
+
+static void BENCH_OldLoop(uint8_t *dest, const uint8_t *src, uint8_t bytePerPixel)
+{
+    if (2U == bytePerPixel)
+    {
+        BENCH_OLD_LOOP(uint16_t, dest, src);
+    }
+    else
+    {
+        BENCH_OLD_LOOP(uint32_t, dest, src);
+    }
+}
+
+static void BENCH_Rotate(uint8_t *dest, const uint8_t *src, uint8_t bytePerPixel)
+{
+    const demo_rotate_image_t srcImage = {
+        .buffer       = (void *)(uintptr_t)src,
+        .strideBytes  = LVGL_BUFFER_WIDTH * bytePerPixel,
+        .width        = LVGL_BUFFER_WIDTH,
+        .height       = LVGL_BUFFER_HEIGHT,
+        .bytePerPixel = bytePerPixel,
+    };
+    const demo_rotate_image_t destImage = {
+        .buffer       = dest,
+        .strideBytes  = DEMO_BUFFER_WIDTH * bytePerPixel,
+        .width        = DEMO_BUFFER_WIDTH,
+        .height       = DEMO_BUFFER_HEIGHT,
+        .bytePerPixel = bytePerPixel,
+    };
+
+    DEMO_Rotate(&destImage, &srcImage, kDEMO_Rotate270);
+}
+
+/* Shortest run of the repeats, in microsecond. */
+static uint32_t BENCH_Run(void (*func)(uint8_t *, const uint8_t *, uint8_t),
+                          uint8_t *dest,
+                          const uint8_t *src,
+                          uint8_t bytePerPixel)
+{
+    uint64_t best = UINT64_MAX;
+    uint64_t start;
+
+    for (uint32_t i = 0U; i < BENCH_REPEAT; i++)
+    {
+        start = BENCH_GetNs();
+        func(dest, src, bytePerPixel);
+        best = MIN(best, BENCH_GetNs() - start);
+    }
+
+    return (uint32_t)(best / 1000U);
+}
+
+int main(void)
+{
+    static const uint8_t formats[] = {2U, 4U};
+    size_t bytes                   = (size_t)(DEMO_BUFFER_HEIGHT + 1U) * DEMO_BUFFER_WIDTH * 4U;
+    uint8_t *src                   = malloc(bytes);
+    uint8_t *dest                  = malloc(bytes);
+    uint32_t oldUs, newUs;
+
+    if ((NULL == src) || (NULL == dest))
+    {
+        return 1;
+    }
+
+    for (size_t i = 0U; i < bytes; i++)
+    {
+        src[i] = (uint8_t)i;
+    }
+    (void)memset(dest, 0, bytes);
+
+    (void)printf("Rotate 270 degree %ux%u, shortest of %u runs\n", LVGL_BUFFER_WIDTH, LVGL_BUFFER_HEIGHT, BENCH_REPEAT);
+
+    for (uint32_t f = 0U; f < ARRAY_SIZE(formats); f++)
+    {
+        oldUs = BENCH_Run(BENCH_OldLoop, dest, src, formats[f]);
+        newUs = BENCH_Run(BENCH_Rotate, dest, src, formats[f]);
+
+        (void)printf("%s: per pixel loop %u us, tiled %u us, %u.%02ux\n", (2U == formats[f]) ? "RGB565" : "XRGB8888",
+                     oldUs, newUs, oldUs / newUs, (oldUs % newUs) * 100U / newUs);
+    }
+
+    free(src);
+    free(dest);
+
+    return 0;
+}
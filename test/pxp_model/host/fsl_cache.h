@@ -0,0 +1,33 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef FSL_CACHE_H_
+#define FSL_CACHE_H_
+
+/* The host memory is coherent, the cache maintenance does nothing. */
+
+#include "fsl_common.h"
+
+static inline void DCACHE_CleanByRange(uint32_t address, uint32_t size_byte)
+{
+    (void)address;
+    (void)size_byte;
+}
+
+static inline void DCACHE_InvalidateByRange(uint32_t address, uint32_t size_byte)
+{
+    (void)address;
+    (void)size_byte;
+}
+
+static inline void DCACHE_CleanInvalidateByRange(uint32_t address, uint32_t size_byte)
+{
+    (void)address;
+    (void)size_byte;
+}
+
+#endif /* FSL_CACHE_H_ */
@@ -0,0 +1,155 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef FSL_COMMON_H_
+#define FSL_COMMON_H_
+
+/*
+ * Host replacement of fsl_common.h, force included before the sources so the
+ * one of the SDK is skipped. The core and the NVIC are replaced by the model.
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "MIMXRT1176_cm7_features.h"
+#include "pxp_model.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+typedef int32_t status_t;
+
+#define MAKE_STATUS(group, code) ((((group)*100L) + (code)))
+#define MAKE_VERSION(major, minor, bugfix) (((major)*65536L) + ((minor)*256L) + (bugfix))
+
+enum _status_groups
+{
+    kStatusGroup_Generic = 0,
+};
+
+enum _generic_status
+{
+    kStatus_Success         = MAKE_STATUS(kStatusGroup_Generic, 0),
+    kStatus_Fail            = MAKE_STATUS(kStatusGroup_Generic, 1),
+    kStatus_ReadOnly        = MAKE_STATUS(kStatusGroup_Generic, 2),
+    kStatus_OutOfRange      = MAKE_STATUS(kStatusGroup_Generic, 3),
+    kStatus_InvalidArgument = MAKE_STATUS(kStatusGroup_Generic, 4),
+    kStatus_Timeout         = MAKE_STATUS(kStatusGroup_Generic, 5),
+    kStatus_NoTransferInProgress = MAKE_STATUS(kStatusGroup_Generic, 6),
+    kStatus_Busy            = MAKE_STATUS(kStatusGroup_Generic, 7),
+    kStatus_NoData          = MAKE_STATUS(kStatusGroup_Generic, 8),
+};
+
+#ifndef MIN
+#define MIN(a, b) (((a) < (b)) ? (a) : (b))
+#endif
+
+#ifndef MAX
+#define MAX(a, b) (((a) > (b)) ? (a) : (b))
+#endif
+
+#ifndef ARRAY_SIZE
+#define ARRAY_SIZE(x) (sizeof(x) / sizeof((x)[0]))
+#endif
+
+#define SDK_ALIGN(var, alignbytes) var __attribute__((aligned(alignbytes)))
+#define SDK_SIZEALIGN(var, alignbytes) (((var) + ((alignbytes)-1U)) & (~((alignbytes)-1U)))
+#define AT_NONCACHEABLE_SECTION(var) var
+#define AT_NONCACHEABLE_SECTION_ALIGN(var, alignbytes) SDK_ALIGN(var, alignbytes)
+#define AT_QUICKACCESS_SECTION_CODE(func) func
+#define AT_QUICKACCESS_SECTION_DATA(var) var
+
+#define SDK_ISR_EXIT_BARRIER
+#define __DSB()
+#define __ISB()
+
+/*! @brief Interrupt numbers, only the PXP one. */
+typedef enum IRQn
+{
+    PXP_IRQn = 59,
+} IRQn_Type;
+
+#define PXP_IRQS {PXP_IRQn}
+
+/*! @brief Clocks, only the PXP one. */
+typedef enum _clock_ip_name
+{
+    kCLOCK_IpInvalid = 0,
+    kCLOCK_Pxp,
+} clock_ip_name_t;
+
+#define PXP_CLOCKS {kCLOCK_Pxp}
+
+extern uint32_t SystemCoreClock;
+
+#define COUNT_TO_USEC(count, clockFreqInHz) (uint64_t)(((uint64_t)(count)*1000000U) / (clockFreqInHz))
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+static inline void CLOCK_EnableClock(clock_ip_name_t name)
+{
+    (void)name;
+}
+
+static inline void CLOCK_DisableClock(clock_ip_name_t name)
+{
+    (void)name;
+}
+
+static inline status_t EnableIRQ(IRQn_Type interrupt)
+{
+    (void)interrupt;
+    PXP_MODEL_EnableIRQ(true);
+    return kStatus_Success;
+}
+
+static inline status_t DisableIRQ(IRQn_Type interrupt)
+{
+    (void)interrupt;
+    PXP_MODEL_EnableIRQ(false);
+    return kStatus_Success;
+}
+
+static inline void NVIC_ClearPendingIRQ(IRQn_Type interrupt)
+{
+    (void)interrupt;
+}
+
+static inline void NVIC_SetPriority(IRQn_Type interrupt, uint32_t priority)
+{
+    (void)interrupt;
+    (void)priority;
+}
+
+static inline uint32_t DisableGlobalIRQ(void)
+{
+    return PXP_MODEL_MaskIRQ(true) ? 1U : 0U;
+}
+
+static inline void EnableGlobalIRQ(uint32_t primask)
+{
+    (void)PXP_MODEL_MaskIRQ(0U != primask);
+}
+
+static inline uint32_t InstallIRQHandler(IRQn_Type irq, uint32_t irqHandler)
+{
+    (void)irq;
+    return (uint32_t)(uintptr_t)PXP_MODEL_SetIRQHandler((pxp_model_irq_handler_t)(uintptr_t)irqHandler);
+}
+
+/* The host cycle counter runs at SystemCoreClock from the monotonic clock. */
+void MSDK_EnableCpuCycleCounter(void);
+uint32_t MSDK_GetCpuCycleCount(void);
+
+#endif /* FSL_COMMON_H_ */
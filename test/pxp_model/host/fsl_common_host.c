@@ -0,0 +1,33 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_common.h"
+#include <time.h>
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+uint32_t SystemCoreClock = 996000000U;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+void MSDK_EnableCpuCycleCounter(void)
+{
+}
+
+uint32_t MSDK_GetCpuCycleCount(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint32_t)((uint64_t)now.tv_sec * SystemCoreClock +
+                      ((uint64_t)now.tv_nsec * (SystemCoreClock / 1000U)) / 1000000U);
+}
@@ -0,0 +1,15 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef FSL_DEBUG_CONSOLE_H_
+#define FSL_DEBUG_CONSOLE_H_
+
+#include <stdio.h>
+
+#define PRINTF printf
+
+#endif /* FSL_DEBUG_CONSOLE_H_ */
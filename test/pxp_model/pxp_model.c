@@ -0,0 +1,855 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "pxp_model.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* The registers are accessed without the synchronizing macros here. */
+#define PXP_MODEL_REG(reg) (g_pxpModelRegs.reg##_[0])
+
+/* Field value of a register value. */
+#define PXP_MODEL_GET(field, value) (((uint32_t)(value) & field##_MASK) >> field##_SHIFT)
+
+/* Registers reset value. */
+#define PXP_MODEL_CTRL_RESET       (PXP_CTRL_SFTRST_MASK | PXP_CTRL_CLKGATE_MASK)
+#define PXP_MODEL_PS_SCALE_RESET   (0x10001000U)
+#define PXP_MODEL_CLRKEYLOW_RESET  (0xFFFFFFU)
+#define PXP_MODEL_CSC1_COEF0_RESET (0x04000000U)
+#define PXP_MODEL_CSC1_COEF1_RESET (0x01230208U)
+#define PXP_MODEL_CSC1_COEF2_RESET (0x076B079CU)
+
+/* Pass of PXP_MODEL_Sync without end, the interrupt is not cleared or the PXP restarts itself. */
+#define PXP_MODEL_SYNC_LOOP_MAX 100000U
+
+/* AS alpha control, same with pxp_alpha_mode_t. */
+#define PXP_MODEL_ALPHA_EMBEDDED 0U
+#define PXP_MODEL_ALPHA_OVERRIDE 1U
+#define PXP_MODEL_ALPHA_MULTIPLY 2U
+#define PXP_MODEL_ALPHA_ROP      3U
+
+/* Porter-Duff factor mode, global alpha mode. */
+#define PXP_MODEL_PD_FACTOR_ONE      0U
+#define PXP_MODEL_PD_FACTOR_ZERO     1U
+#define PXP_MODEL_PD_FACTOR_STRAIGHT 2U
+#define PXP_MODEL_PD_GLOBAL_ALPHA    0U
+#define PXP_MODEL_PD_LOCAL_ALPHA     1U
+
+/*! @brief Pixel layout in memory, a channel of 0 bits is not stored. */
+typedef struct _pxp_model_layout
+{
+    uint8_t bytes;
+    uint8_t bits[4];  /* A, R, G, B. */
+    uint8_t shift[4]; /* A, R, G, B. */
+} pxp_model_layout_t;
+
+/*! @brief Pixel with 8-bit channels. */
+typedef struct _pxp_model_pixel
+{
+    uint8_t c[4]; /* A, R, G, B. */
+} pxp_model_pixel_t;
+
+/*! @brief Porter-Duff layer configuration. */
+typedef struct _pxp_model_pd_layer
+{
+    uint32_t factorMode;
+    uint32_t globalAlphaMode;
+    uint32_t alphaMode;
+    uint32_t colorMode;
+    uint32_t globalAlpha;
+} pxp_model_pd_layer_t;
+
+/*! @brief Model state besides the registers. */
+typedef struct _pxp_model
+{
+    pxp_model_irq_handler_t handler;
+    bool irqEnabled;
+    bool irqMasked;
+    /* In PXP_MODEL_Sync, the nested calls only apply the alias writes. */
+    bool running;
+    pxp_model_stat_t stat;
+} pxp_model_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static void PXP_MODEL_Abort(const char *reason);
+static void PXP_MODEL_ResetRegs(void);
+static void PXP_MODEL_ApplyAlias(void);
+static bool PXP_MODEL_IsIRQPending(void);
+static void PXP_MODEL_LoadCommand(void);
+static void PXP_MODEL_Process(void);
+static bool PXP_MODEL_GetLayout(uint32_t format, const pxp_model_layout_t **layout);
+static bool PXP_MODEL_GetPsLayout(uint32_t format, const pxp_model_layout_t **layout);
+static pxp_model_pixel_t PXP_MODEL_ReadPixel(uint32_t addr, const pxp_model_layout_t *layout, bool swapByte);
+static void PXP_MODEL_WritePixel(uint32_t addr, const pxp_model_layout_t *layout, pxp_model_pixel_t pixel);
+static pxp_model_pixel_t PXP_MODEL_ColorPixel(uint32_t color, uint8_t alpha);
+static bool PXP_MODEL_IsColorKeyed(pxp_model_pixel_t pixel, uint32_t low, uint32_t high);
+static pxp_model_pixel_t PXP_MODEL_SamplePs(uint32_t dx, uint32_t dy, const pxp_model_layout_t *layout);
+static pxp_model_pixel_t PXP_MODEL_Rop(uint32_t rop, pxp_model_pixel_t as, pxp_model_pixel_t ps);
+static pxp_model_pixel_t PXP_MODEL_Blend(uint32_t asCtrl, pxp_model_pixel_t as, pxp_model_pixel_t ps);
+static pxp_model_pixel_t PXP_MODEL_PorterDuff(uint32_t pdCtrl, pxp_model_pixel_t s0, pxp_model_pixel_t s1);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+PXP_Type g_pxpModelRegs;
+
+static pxp_model_t s_model;
+
+/* Indexed by the AS and output format, NULL if not modelled. */
+static const pxp_model_layout_t s_argb8888 = {4U, {8U, 8U, 8U, 8U}, {24U, 16U, 8U, 0U}};
+static const pxp_model_layout_t s_rgba8888 = {4U, {8U, 8U, 8U, 8U}, {0U, 24U, 16U, 8U}};
+static const pxp_model_layout_t s_rgb888   = {4U, {0U, 8U, 8U, 8U}, {0U, 16U, 8U, 0U}};
+static const pxp_model_layout_t s_rgb888p  = {3U, {0U, 8U, 8U, 8U}, {0U, 16U, 8U, 0U}};
+static const pxp_model_layout_t s_argb1555 = {2U, {1U, 5U, 5U, 5U}, {15U, 10U, 5U, 0U}};
+static const pxp_model_layout_t s_argb4444 = {2U, {4U, 4U, 4U, 4U}, {12U, 8U, 4U, 0U}};
+static const pxp_model_layout_t s_rgba5551 = {2U, {1U, 5U, 5U, 5U}, {0U, 11U, 6U, 1U}};
+static const pxp_model_layout_t s_rgba4444 = {2U, {4U, 4U, 4U, 4U}, {0U, 12U, 8U, 4U}};
+static const pxp_model_layout_t s_rgb555   = {2U, {0U, 5U, 5U, 5U}, {0U, 10U, 5U, 0U}};
+static const pxp_model_layout_t s_rgb444   = {2U, {0U, 4U, 4U, 4U}, {0U, 8U, 4U, 0U}};
+static const pxp_model_layout_t s_rgb565   = {2U, {0U, 5U, 6U, 5U}, {0U, 11U, 5U, 0U}};
+
+static const pxp_model_layout_t *const s_layouts[16] = {
+    [0x0] = &s_argb8888, [0x1] = &s_rgba8888, [0x4] = &s_rgb888,   [0x5] = &s_rgb888p,
+    [0x8] = &s_argb1555, [0x9] = &s_argb4444, [0xA] = &s_rgba5551, [0xB] = &s_rgba4444,
+    [0xC] = &s_rgb555,   [0xD] = &s_rgb444,   [0xE] = &s_rgb565,
+};
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void PXP_MODEL_Abort(const char *reason)
+{
+    (void)fprintf(stderr, "PXP model: %s\n", reason);
+    abort();
+}
+
+static void PXP_MODEL_ResetRegs(void)
+{
+    (void)memset(&g_pxpModelRegs, 0, sizeof(g_pxpModelRegs));
+
+    PXP_MODEL_REG(CTRL)            = PXP_MODEL_CTRL_RESET;
+    g_pxpModelRegs.PS_SCALE        = PXP_MODEL_PS_SCALE_RESET;
+    g_pxpModelRegs.PS_CLRKEYLOW_0  = PXP_MODEL_CLRKEYLOW_RESET;
+    g_pxpModelRegs.AS_CLRKEYLOW_0  = PXP_MODEL_CLRKEYLOW_RESET;
+    g_pxpModelRegs.CSC1_COEF0      = PXP_MODEL_CSC1_COEF0_RESET;
+    g_pxpModelRegs.CSC1_COEF1      = PXP_MODEL_CSC1_COEF1_RESET;
+    g_pxpModelRegs.CSC1_COEF2      = PXP_MODEL_CSC1_COEF2_RESET;
+}
+
+void PXP_MODEL_Reset(void)
+{
+    PXP_MODEL_ResetRegs();
+    (void)memset(&s_model, 0, sizeof(s_model));
+}
+
+/* At most one alias write is pending, every register access applies it first. */
+static void PXP_MODEL_ApplyAlias(void)
+{
+    uint32_t value;
+
+    value = PXP_MODEL_REG(CTRL_SET);
+    if (0U != value)
+    {
+        PXP_MODEL_REG(CTRL_SET) = 0U;
+
+        if (0U != (value & PXP_CTRL_SFTRST_MASK))
+        {
+            PXP_MODEL_ResetRegs();
+        }
+
+        PXP_MODEL_REG(CTRL) |= value;
+    }
+
+    PXP_MODEL_REG(CTRL) &= ~PXP_MODEL_REG(CTRL_CLR);
+    PXP_MODEL_REG(CTRL) ^= PXP_MODEL_REG(CTRL_TOG);
+    PXP_MODEL_REG(STAT) |= PXP_MODEL_REG(STAT_SET);
+    PXP_MODEL_REG(STAT) &= ~PXP_MODEL_REG(STAT_CLR);
+    PXP_MODEL_REG(STAT) ^= PXP_MODEL_REG(STAT_TOG);
+    PXP_MODEL_REG(OUT_CTRL) |= PXP_MODEL_REG(OUT_CTRL_SET);
+    PXP_MODEL_REG(OUT_CTRL) &= ~PXP_MODEL_REG(OUT_CTRL_CLR);
+    PXP_MODEL_REG(OUT_CTRL) ^= PXP_MODEL_REG(OUT_CTRL_TOG);
+
+    PXP_MODEL_REG(CTRL_CLR)     = 0U;
+    PXP_MODEL_REG(CTRL_TOG)     = 0U;
+    PXP_MODEL_REG(STAT_SET)     = 0U;
+    PXP_MODEL_REG(STAT_CLR)     = 0U;
+    PXP_MODEL_REG(STAT_TOG)     = 0U;
+    PXP_MODEL_REG(OUT_CTRL_SET) = 0U;
+    PXP_MODEL_REG(OUT_CTRL_CLR) = 0U;
+    PXP_MODEL_REG(OUT_CTRL_TOG) = 0U;
+
+    /* Writing the pointer enables the command. */
+    if (0U != (PXP_MODEL_REG(NEXT) & PXP_NEXT_POINTER_MASK))
+    {
+        PXP_MODEL_REG(NEXT) |= PXP_NEXT_ENABLED_MASK;
+    }
+}
+
+static bool PXP_MODEL_IsIRQPending(void)
+{
+    uint32_t ctrl = PXP_MODEL_REG(CTRL);
+    uint32_t stat = PXP_MODEL_REG(STAT);
+
+    return ((0U != (stat & PXP_STAT_IRQ0_MASK)) && (0U != (ctrl & PXP_CTRL_IRQ_ENABLE_MASK))) ||
+           ((0U != (stat & PXP_STAT_NEXT_IRQ_MASK)) && (0U != (ctrl & PXP_CTRL_NEXT_IRQ_ENABLE_MASK)));
+}
+
+uint32_t PXP_MODEL_Sync(void)
+{
+    uint32_t loop;
+
+    PXP_MODEL_ApplyAlias();
+
+    if (s_model.running)
+    {
+        return 0U;
+    }
+
+    s_model.running = true;
+
+    for (loop = 0U;; loop++)
+    {
+        if (loop >= PXP_MODEL_SYNC_LOOP_MAX)
+        {
+            PXP_MODEL_Abort("the interrupt is not cleared, or the PXP never stops");
+        }
+
+        PXP_MODEL_ApplyAlias();
+
+        if ((NULL != s_model.handler) && s_model.irqEnabled && (!s_model.irqMasked) && PXP_MODEL_IsIRQPending())
+        {
+            s_model.stat.interrupts++;
+            s_model.handler();
+        }
+        else if (0U != (PXP_MODEL_REG(CTRL) & PXP_CTRL_ENABLE_MASK))
+        {
+            PXP_MODEL_Process();
+
+            PXP_MODEL_REG(CTRL) &= ~PXP_CTRL_ENABLE_MASK;
+            PXP_MODEL_REG(STAT) |= PXP_STAT_IRQ0_MASK;
+            s_model.stat.operations++;
+        }
+        else if (0U != (PXP_MODEL_REG(NEXT) & PXP_NEXT_ENABLED_MASK))
+        {
+            PXP_MODEL_LoadCommand();
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    s_model.running = false;
+
+    return 0U;
+}
+
+pxp_model_irq_handler_t PXP_MODEL_SetIRQHandler(pxp_model_irq_handler_t handler)
+{
+    pxp_model_irq_handler_t prev = s_model.handler;
+
+    s_model.handler = handler;
+
+    return prev;
+}
+
+void PXP_MODEL_EnableIRQ(bool enable)
+{
+    s_model.irqEnabled = enable;
+
+    (void)PXP_MODEL_Sync();
+}
+
+bool PXP_MODEL_MaskIRQ(bool mask)
+{
+    bool prev = s_model.irqMasked;
+
+    s_model.irqMasked = mask;
+
+    if (!mask)
+    {
+        (void)PXP_MODEL_Sync();
+    }
+
+    return prev;
+}
+
+void PXP_MODEL_GetStat(pxp_model_stat_t *stat)
+{
+    *stat = s_model.stat;
+}
+
+uint32_t PXP_MODEL_Addr(const void *ptr)
+{
+    if ((uintptr_t)ptr > UINT32_MAX)
+    {
+        PXP_MODEL_Abort("memory above 4 GiB, link without PIE and use static buffers");
+    }
+
+    return (uint32_t)(uintptr_t)ptr;
+}
+
+/* The registers are loaded in the order of the register map, without STAT. */
+static void PXP_MODEL_LoadCommand(void)
+{
+    const volatile uint32_t *cmd =
+        (const volatile uint32_t *)(uintptr_t)(PXP_MODEL_REG(NEXT) & PXP_NEXT_POINTER_MASK);
+    volatile uint32_t *const regs[] = {
+        &PXP_MODEL_REG(CTRL),           &PXP_MODEL_REG(OUT_CTRL),      &g_pxpModelRegs.OUT_BUF,
+        &g_pxpModelRegs.OUT_BUF2,       &g_pxpModelRegs.OUT_PITCH,     &g_pxpModelRegs.OUT_LRC,
+        &g_pxpModelRegs.OUT_PS_ULC,     &g_pxpModelRegs.OUT_PS_LRC,    &g_pxpModelRegs.OUT_AS_ULC,
+        &g_pxpModelRegs.OUT_AS_LRC,     &g_pxpModelRegs.PS_CTRL,       &g_pxpModelRegs.PS_BUF,
+        &g_pxpModelRegs.PS_UBUF,        &g_pxpModelRegs.PS_VBUF,       &g_pxpModelRegs.PS_PITCH,
+        &g_pxpModelRegs.PS_BACKGROUND_0, &g_pxpModelRegs.PS_SCALE,     &g_pxpModelRegs.PS_OFFSET,
+        &g_pxpModelRegs.PS_CLRKEYLOW_0, &g_pxpModelRegs.PS_CLRKEYHIGH_0, &g_pxpModelRegs.AS_CTRL,
+        &g_pxpModelRegs.AS_BUF,         &g_pxpModelRegs.AS_PITCH,      &g_pxpModelRegs.AS_CLRKEYLOW_0,
+        &g_pxpModelRegs.AS_CLRKEYHIGH_0,
+    };
+    uint32_t i;
+
+    for (i = 0U; i < (sizeof(regs) / sizeof(regs[0])); i++)
+    {
+        *regs[i] = cmd[i];
+    }
+
+    PXP_MODEL_REG(NEXT) = 0U;
+    PXP_MODEL_REG(STAT) |= PXP_STAT_NEXT_IRQ_MASK;
+    s_model.stat.commands++;
+}
+
+static bool PXP_MODEL_GetLayout(uint32_t format, const pxp_model_layout_t **layout)
+{
+    *layout = (format < (sizeof(s_layouts) / sizeof(s_layouts[0]))) ? s_layouts[format] : NULL;
+
+    return (NULL != *layout);
+}
+
+/* The PS formats with alpha are the RGB formats of the AS in other positions. */
+static bool PXP_MODEL_GetPsLayout(uint32_t format, const pxp_model_layout_t **layout)
+{
+    switch (format)
+    {
+        case 0x4U:
+            *layout = &s_argb8888;
+            break;
+        case 0xCU:
+            *layout = &s_argb1555;
+            break;
+        case 0xDU:
+            *layout = &s_argb4444;
+            break;
+        case 0xEU:
+            *layout = &s_rgb565;
+            break;
+        case 0x24U:
+            *layout = &s_rgba8888;
+            break;
+        case 0x2CU:
+            *layout = &s_rgba5551;
+            break;
+        case 0x2DU:
+            *layout = &s_rgba4444;
+            break;
+        default:
+            *layout = NULL;
+            break;
+    }
+
+    return (NULL != *layout);
+}
+
+static pxp_model_pixel_t PXP_MODEL_ReadPixel(uint32_t addr, const pxp_model_layout_t *layout, bool swapByte)
+{
+    const uint8_t *p = (const uint8_t *)(uintptr_t)addr;
+    pxp_model_pixel_t pixel;
+    uint32_t value = 0U;
+    uint32_t channel;
+    uint32_t bits;
+    uint32_t field;
+    int32_t shift;
+    uint32_t i;
+
+    for (i = 0U; i < layout->bytes; i++)
+    {
+        value |= (uint32_t)p[i] << (8U * i);
+    }
+
+    if (swapByte)
+    {
+        value = ((value & 0x00FF00FFU) << 8U) | ((value & 0xFF00FF00U) >> 8U);
+    }
+
+    for (i = 0U; i < 4U; i++)
+    {
+        bits = layout->bits[i];
+
+        if (0U == bits)
+        {
+            /* No alpha in the format, opaque. */
+            pixel.c[i] = 0xFFU;
+            continue;
+        }
+
+        /* Expanded to 8 bits by repeating the bits. */
+        field   = (value >> layout->shift[i]) & ((1UL << bits) - 1U);
+        channel = 0U;
+        for (shift = 8 - (int32_t)bits; shift > -(int32_t)bits; shift -= (int32_t)bits)
+        {
+            channel |= (shift >= 0) ? (field << (uint32_t)shift) : (field >> (uint32_t)(-shift));
+        }
+        pixel.c[i] = (uint8_t)channel;
+    }
+
+    s_model.stat.bytesRead += layout->bytes;
+
+    return pixel;
+}
+
+/* The channels not in the format are written as 0. */
+static void PXP_MODEL_WritePixel(uint32_t addr, const pxp_model_layout_t *layout, pxp_model_pixel_t pixel)
+{
+    uint8_t *p     = (uint8_t *)(uintptr_t)addr;
+    uint32_t value = 0U;
+    uint32_t bits;
+    uint32_t i;
+
+    for (i = 0U; i < 4U; i++)
+    {
+        bits = layout->bits[i];
+
+        if (0U != bits)
+        {
+            value |= ((uint32_t)pixel.c[i] >> (8U - bits)) << layout->shift[i];
+        }
+    }
+
+    for (i = 0U; i < layout->bytes; i++)
+    {
+        p[i] = (uint8_t)(value >> (8U * i));
+    }
+
+    s_model.stat.bytesWritten += layout->bytes;
+}
+
+static pxp_model_pixel_t PXP_MODEL_ColorPixel(uint32_t color, uint8_t alpha)
+{
+    pxp_model_pixel_t pixel;
+
+    pixel.c[0] = alpha;
+    pixel.c[1] = (uint8_t)(color >> 16U);
+    pixel.c[2] = (uint8_t)(color >> 8U);
+    pixel.c[3] = (uint8_t)color;
+
+    return pixel;
+}
+
+/* Every color channel is compared with the range. */
+static bool PXP_MODEL_IsColorKeyed(pxp_model_pixel_t pixel, uint32_t low, uint32_t high)
+{
+    pxp_model_pixel_t lowPixel  = PXP_MODEL_ColorPixel(low, 0U);
+    pxp_model_pixel_t highPixel = PXP_MODEL_ColorPixel(high, 0U);
+    uint32_t i;
+
+    for (i = 1U; i < 4U; i++)
+    {
+        if ((pixel.c[i] < lowPixel.c[i]) || (pixel.c[i] > highPixel.c[i]))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*
+ * The PS pixel at the output position (dx, dy) in the PS area. The decimated
+ * pixel is the average of the input block, the nearest one is used.
+ */
+static pxp_model_pixel_t PXP_MODEL_SamplePs(uint32_t dx, uint32_t dy, const pxp_model_layout_t *layout)
+{
+    uint32_t psCtrl   = g_pxpModelRegs.PS_CTRL;
+    uint32_t scale    = g_pxpModelRegs.PS_SCALE;
+    uint32_t offset   = g_pxpModelRegs.PS_OFFSET;
+    uint32_t decX     = PXP_MODEL_GET(PXP_PS_CTRL_DECX, psCtrl);
+    uint32_t decY     = PXP_MODEL_GET(PXP_PS_CTRL_DECY, psCtrl);
+    bool swapByte     = (0U != (psCtrl & PXP_PS_CTRL_WB_SWAP_MASK));
+    uint32_t x        = (PXP_MODEL_GET(PXP_PS_OFFSET_XOFFSET, offset) + dx * PXP_MODEL_GET(PXP_PS_SCALE_XSCALE, scale)) >> 12U;
+    uint32_t y        = (PXP_MODEL_GET(PXP_PS_OFFSET_YOFFSET, offset) + dy * PXP_MODEL_GET(PXP_PS_SCALE_YSCALE, scale)) >> 12U;
+    uint32_t blockW   = 1UL << decX;
+    uint32_t blockH   = 1UL << decY;
+    uint32_t sum[4]   = {0U};
+    pxp_model_pixel_t pixel;
+    uint32_t addr;
+    uint32_t i, j, k;
+
+    for (j = 0U; j < blockH; j++)
+    {
+        for (i = 0U; i < blockW; i++)
+        {
+            addr = g_pxpModelRegs.PS_BUF + ((y << decY) + j) * g_pxpModelRegs.PS_PITCH +
+                   ((x << decX) + i) * layout->bytes;
+
+            pixel = PXP_MODEL_ReadPixel(addr, layout, swapByte);
+
+            for (k = 0U; k < 4U; k++)
+            {
+                sum[k] += pixel.c[k];
+            }
+        }
+    }
+
+    for (k = 0U; k < 4U; k++)
+    {
+        pixel.c[k] = (uint8_t)(sum[k] >> (decX + decY));
+    }
+
+    return pixel;
+}
+
+/* The ROP is done on all bits, alpha included, so 32-bit pixels are copied unchanged. */
+static pxp_model_pixel_t PXP_MODEL_Rop(uint32_t rop, pxp_model_pixel_t as, pxp_model_pixel_t ps)
+{
+    pxp_model_pixel_t out;
+    uint32_t a, p, o;
+    uint32_t i;
+
+    for (i = 0U; i < 4U; i++)
+    {
+        a = as.c[i];
+        p = ps.c[i];
+
+        switch (rop)
+        {
+            case 0x0U:
+                o = a & p;
+                break;
+            case 0x1U:
+                o = ~a & p;
+                break;
+            case 0x2U:
+                o = a & ~p;
+                break;
+            case 0x3U:
+                o = a | p;
+                break;
+            case 0x4U:
+                o = ~a | p;
+                break;
+            case 0x5U:
+                o = a | ~p;
+                break;
+            case 0x6U:
+                o = ~a;
+                break;
+            case 0x7U:
+                o = ~p;
+                break;
+            case 0x8U:
+                o = ~(a & p);
+                break;
+            case 0x9U:
+                o = ~(a | p);
+                break;
+            case 0xAU:
+                o = a ^ p;
+                break;
+            case 0xBU:
+                o = ~(a ^ p);
+                break;
+            default:
+                PXP_MODEL_Abort("ROP not defined");
+                o = 0U;
+                break;
+        }
+
+        out.c[i] = (uint8_t)o;
+    }
+
+    return out;
+}
+
+/* The alpha used for the AS, the output alpha is the AS one. */
+static pxp_model_pixel_t PXP_MODEL_Blend(uint32_t asCtrl, pxp_model_pixel_t as, pxp_model_pixel_t ps)
+{
+    uint32_t alphaCtrl = PXP_MODEL_GET(PXP_AS_CTRL_ALPHA_CTRL, asCtrl);
+    uint32_t alpha     = PXP_MODEL_GET(PXP_AS_CTRL_ALPHA, asCtrl);
+    pxp_model_pixel_t out;
+    uint32_t i;
+
+    if (PXP_MODEL_ALPHA_EMBEDDED == alphaCtrl)
+    {
+        alpha = as.c[0];
+    }
+    else if (PXP_MODEL_ALPHA_MULTIPLY == alphaCtrl)
+    {
+        alpha = (as.c[0] * alpha) / 255U;
+    }
+    else
+    {
+        /* Override. */
+    }
+
+    if (0U != (asCtrl & PXP_AS_CTRL_ALPHA0_INVERT_MASK))
+    {
+        alpha = 255U - alpha;
+    }
+
+    out.c[0] = (uint8_t)alpha;
+    for (i = 1U; i < 4U; i++)
+    {
+        out.c[i] = (uint8_t)((as.c[i] * alpha + ps.c[i] * (255U - alpha)) / 255U);
+    }
+
+    return out;
+}
+
+/*
+ * s0 is the PS, s1 is the AS. The factor of one layer is selected by the other
+ * layer alpha: out = s0 * f(s1 alpha) + s1 * f(s0 alpha).
+ */
+static pxp_model_pixel_t PXP_MODEL_PorterDuff(uint32_t pdCtrl, pxp_model_pixel_t s0, pxp_model_pixel_t s1)
+{
+    const pxp_model_pd_layer_t layers[2] = {
+        {
+            .factorMode      = PXP_MODEL_GET(PXP_PORTER_DUFF_CTRL_S1_S0_FACTOR_MODE, pdCtrl),
+            .globalAlphaMode = PXP_MODEL_GET(PXP_PORTER_DUFF_CTRL_S0_GLOBAL_ALPHA_MODE, pdCtrl),
+            .alphaMode       = PXP_MODEL_GET(PXP_PORTER_DUFF_CTRL_S0_ALPHA_MODE, pdCtrl),
+            .colorMode       = PXP_MODEL_GET(PXP_PORTER_DUFF_CTRL_S0_COLOR_MODE, pdCtrl),
+            .globalAlpha     = PXP_MODEL_GET(PXP_PORTER_DUFF_CTRL_S0_GLOBAL_ALPHA, pdCtrl),
+        },
+        {
+            .factorMode      = PXP_MODEL_GET(PXP_PORTER_DUFF_CTRL_S0_S1_FACTOR_MODE, pdCtrl),
+            .globalAlphaMode = PXP_MODEL_GET(PXP_PORTER_DUFF_CTRL_S1_GLOBAL_ALPHA_MODE, pdCtrl),
+            .alphaMode       = PXP_MODEL_GET(PXP_PORTER_DUFF_CTRL_S1_ALPHA_MODE, pdCtrl),
+            .colorMode       = PXP_MODEL_GET(PXP_PORTER_DUFF_CTRL_S1_COLOR_MODE, pdCtrl),
+            .globalAlpha     = PXP_MODEL_GET(PXP_PORTER_DUFF_CTRL_S1_GLOBAL_ALPHA, pdCtrl),
+        },
+    };
+    pxp_model_pixel_t src[2] = {s0, s1};
+    uint32_t alpha[2];
+    uint32_t factor[2];
+    pxp_model_pixel_t out;
+    uint32_t value;
+    uint32_t i, k;
+
+    for (k = 0U; k < 2U; k++)
+    {
+        if (PXP_MODEL_PD_GLOBAL_ALPHA == layers[k].globalAlphaMode)
+        {
+            alpha[k] = layers[k].globalAlpha;
+        }
+        else if (PXP_MODEL_PD_LOCAL_ALPHA == layers[k].globalAlphaMode)
+        {
+            alpha[k] = src[k].c[0];
+        }
+        else
+        {
+            alpha[k] = (src[k].c[0] * layers[k].globalAlpha) / 255U;
+        }
+
+        if (0U != layers[k].alphaMode)
+        {
+            alpha[k] = 255U - alpha[k];
+        }
+
+        if (0U != layers[k].colorMode)
+        {
+            for (i = 1U; i < 4U; i++)
+            {
+                src[k].c[i] = (uint8_t)((src[k].c[i] * alpha[k]) / 255U);
+            }
+        }
+    }
+
+    for (k = 0U; k < 2U; k++)
+    {
+        /* The factor of this layer depends on the other layer alpha. */
+        switch (layers[k].factorMode)
+        {
+            case PXP_MODEL_PD_FACTOR_ONE:
+                factor[k] = 255U;
+                break;
+            case PXP_MODEL_PD_FACTOR_ZERO:
+                factor[k] = 0U;
+                break;
+            case PXP_MODEL_PD_FACTOR_STRAIGHT:
+                factor[k] = alpha[1U - k];
+                break;
+            default:
+                factor[k] = 255U - alpha[1U - k];
+                break;
+        }
+    }
+
+    for (i = 0U; i < 4U; i++)
+    {
+        value = (i == 0U) ? ((alpha[0] * factor[0] + alpha[1] * factor[1]) / 255U) :
+                            ((src[0].c[i] * factor[0] + src[1].c[i] * factor[1]) / 255U);
+
+        out.c[i] = (uint8_t)((value > 255U) ? 255U : value);
+    }
+
+    return out;
+}
+
+static void PXP_MODEL_Process(void)
+{
+    uint32_t ctrl    = PXP_MODEL_REG(CTRL);
+    uint32_t outCtrl = PXP_MODEL_REG(OUT_CTRL);
+    uint32_t asCtrl  = g_pxpModelRegs.AS_CTRL;
+    uint32_t pdCtrl  = g_pxpModelRegs.PORTER_DUFF_CTRL;
+    uint32_t width   = PXP_MODEL_GET(PXP_OUT_LRC_X, g_pxpModelRegs.OUT_LRC) + 1U;
+    uint32_t height  = PXP_MODEL_GET(PXP_OUT_LRC_Y, g_pxpModelRegs.OUT_LRC) + 1U;
+    uint32_t psUlcX  = PXP_MODEL_GET(PXP_OUT_PS_ULC_X, g_pxpModelRegs.OUT_PS_ULC);
+    uint32_t psUlcY  = PXP_MODEL_GET(PXP_OUT_PS_ULC_Y, g_pxpModelRegs.OUT_PS_ULC);
+    uint32_t psLrcX  = PXP_MODEL_GET(PXP_OUT_PS_LRC_X, g_pxpModelRegs.OUT_PS_LRC);
+    uint32_t psLrcY  = PXP_MODEL_GET(PXP_OUT_PS_LRC_Y, g_pxpModelRegs.OUT_PS_LRC);
+    uint32_t asUlcX  = PXP_MODEL_GET(PXP_OUT_AS_ULC_X, g_pxpModelRegs.OUT_AS_ULC);
+    uint32_t asUlcY  = PXP_MODEL_GET(PXP_OUT_AS_ULC_Y, g_pxpModelRegs.OUT_AS_ULC);
+    uint32_t asLrcX  = PXP_MODEL_GET(PXP_OUT_AS_LRC_X, g_pxpModelRegs.OUT_AS_LRC);
+    uint32_t asLrcY  = PXP_MODEL_GET(PXP_OUT_AS_LRC_Y, g_pxpModelRegs.OUT_AS_LRC);
+    uint32_t rotate  = PXP_MODEL_GET(PXP_CTRL_ROTATE0, ctrl);
+    bool hflip       = (0U != (ctrl & PXP_CTRL_HFLIP0_MASK));
+    bool vflip       = (0U != (ctrl & PXP_CTRL_VFLIP0_MASK));
+    bool psEnabled   = (psUlcX <= psLrcX) && (psUlcY <= psLrcY);
+    bool asEnabled   = (asUlcX <= asLrcX) && (asUlcY <= asLrcY);
+    const pxp_model_layout_t *outLayout;
+    const pxp_model_layout_t *psLayout = NULL;
+    const pxp_model_layout_t *asLayout = NULL;
+    pxp_model_pixel_t background;
+    pxp_model_pixel_t ps;
+    pxp_model_pixel_t as;
+    pxp_model_pixel_t out;
+    uint32_t x, y;
+    uint32_t fx, fy;
+    uint32_t ox, oy;
+    uint32_t addr;
+
+    if (0U != (ctrl & (PXP_CTRL_SFTRST_MASK | PXP_CTRL_CLKGATE_MASK)))
+    {
+        PXP_MODEL_Abort("started in reset or with the clock gated");
+    }
+
+    if (0U != (ctrl & (PXP_CTRL_ROTATE1_MASK | PXP_CTRL_HFLIP1_MASK | PXP_CTRL_VFLIP1_MASK)))
+    {
+        PXP_MODEL_Abort("PS rotation not modelled");
+    }
+
+    if ((0U == (ctrl & PXP_CTRL_ENABLE_PS_AS_OUT_MASK)) || (0U == (ctrl & PXP_CTRL_ENABLE_ROTATE0_MASK)))
+    {
+        s_model.stat.dropped++;
+        return;
+    }
+
+    if ((0U != PXP_MODEL_GET(PXP_OUT_CTRL_INTERLACED_OUTPUT, outCtrl)) ||
+        (!PXP_MODEL_GetLayout(PXP_MODEL_GET(PXP_OUT_CTRL_FORMAT, outCtrl), &outLayout)) ||
+        (psEnabled && (!PXP_MODEL_GetPsLayout(PXP_MODEL_GET(PXP_PS_CTRL_FORMAT, g_pxpModelRegs.PS_CTRL), &psLayout))) ||
+        (asEnabled && (!PXP_MODEL_GetLayout(PXP_MODEL_GET(PXP_AS_CTRL_FORMAT, asCtrl), &asLayout))))
+    {
+        PXP_MODEL_Abort("pixel format or output mode not modelled");
+    }
+
+    if ((0U == g_pxpModelRegs.OUT_BUF) || (psEnabled && (0U == g_pxpModelRegs.PS_BUF)) ||
+        (asEnabled && (0U == g_pxpModelRegs.AS_BUF)))
+    {
+        PXP_MODEL_REG(STAT) |=
+            (0U == g_pxpModelRegs.OUT_BUF) ? PXP_STAT_AXI_WRITE_ERROR_0_MASK : PXP_STAT_AXI_READ_ERROR_0_MASK;
+        return;
+    }
+
+    background = PXP_MODEL_ColorPixel(g_pxpModelRegs.PS_BACKGROUND_0, 0U);
+
+    for (y = 0U; y < height; y++)
+    {
+        for (x = 0U; x < width; x++)
+        {
+            ps = background;
+
+            if (psEnabled && (x >= psUlcX) && (x <= psLrcX) && (y >= psUlcY) && (y <= psLrcY))
+            {
+                ps = PXP_MODEL_SamplePs(x - psUlcX, y - psUlcY, psLayout);
+
+                if (PXP_MODEL_IsColorKeyed(ps, g_pxpModelRegs.PS_CLRKEYLOW_0, g_pxpModelRegs.PS_CLRKEYHIGH_0))
+                {
+                    ps = background;
+                }
+            }
+
+            out = ps;
+
+            if (asEnabled && (x >= asUlcX) && (x <= asLrcX) && (y >= asUlcY) && (y <= asLrcY))
+            {
+                addr = g_pxpModelRegs.AS_BUF + (y - asUlcY) * g_pxpModelRegs.AS_PITCH + (x - asUlcX) * asLayout->bytes;
+                as   = PXP_MODEL_ReadPixel(addr, asLayout, false);
+
+                if ((0U != (asCtrl & PXP_AS_CTRL_ENABLE_COLORKEY_MASK)) &&
+                    PXP_MODEL_IsColorKeyed(as, g_pxpModelRegs.AS_CLRKEYLOW_0, g_pxpModelRegs.AS_CLRKEYHIGH_0))
+                {
+                    /* The AS is transparent, its alpha is kept. */
+                    out      = PXP_MODEL_Blend(asCtrl, as, ps);
+                    out.c[1] = ps.c[1];
+                    out.c[2] = ps.c[2];
+                    out.c[3] = ps.c[3];
+                }
+                else if (0U != (pdCtrl & PXP_PORTER_DUFF_CTRL_POTER_DUFF_ENABLE_MASK))
+                {
+                    out = PXP_MODEL_PorterDuff(pdCtrl, ps, as);
+                }
+                else if (PXP_MODEL_ALPHA_ROP == PXP_MODEL_GET(PXP_AS_CTRL_ALPHA_CTRL, asCtrl))
+                {
+                    out = PXP_MODEL_Rop(PXP_MODEL_GET(PXP_AS_CTRL_ROP, asCtrl), as, ps);
+                }
+                else
+                {
+                    out = PXP_MODEL_Blend(asCtrl, as, ps);
+                }
+            }
+
+            if (0U != (outCtrl & PXP_OUT_CTRL_ALPHA_OUTPUT_MASK))
+            {
+                out.c[0] = (uint8_t)PXP_MODEL_GET(PXP_OUT_CTRL_ALPHA, outCtrl);
+            }
+
+            /* Flip, then rotate clockwise, the output size is the one before rotation. */
+            fx = hflip ? (width - 1U - x) : x;
+            fy = vflip ? (height - 1U - y) : y;
+
+            switch (rotate)
+            {
+                case 1U:
+                    ox = height - 1U - fy;
+                    oy = fx;
+                    break;
+                case 2U:
+                    ox = width - 1U - fx;
+                    oy = height - 1U - fy;
+                    break;
+                case 3U:
+                    ox = fy;
+                    oy = width - 1U - fx;
+                    break;
+                default:
+                    ox = fx;
+                    oy = fy;
+                    break;
+            }
+
+            PXP_MODEL_WritePixel(g_pxpModelRegs.OUT_BUF + oy * g_pxpModelRegs.OUT_PITCH + ox * outLayout->bytes,
+                                 outLayout, out);
+            s_model.stat.pixelsOut++;
+        }
+    }
+}
@@ -0,0 +1,453 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _PXP_MODEL_H_
+#define _PXP_MODEL_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Host functional model of the RT1170 PXP, the device header and the hardware
+ * replaced by plain memory, so fsl_pxp.c and the PXP users of the board could
+ * be built and tested on Linux.
+ *
+ * Only the registers and fields used by the driver for RT1170 are defined, with
+ * the names and offsets of the device header. The bus address is the host
+ * address, the buffers and commands must be below 4 GiB, so the executables
+ * are linked without PIE and use static buffers.
+ *
+ * The registers with SET/CLR/TOG aliases and NEXT are accessed through macros
+ * calling PXP_MODEL_Sync, so an alias write takes effect before the next
+ * access as on hardware. The same call runs the PXP: the operation started by
+ * CTRL[ENABLE] or loaded by NEXT is done at once, STAT is updated and the
+ * interrupt handler is called, unless the interrupt is masked by
+ * DisableGlobalIRQ, then it is called when unmasked.
+ *
+ * The model:
+ * - Runs PS, AS, ROP, AS alpha blending, Porter-Duff, color keys, PS background,
+ *   PS decimation and scaling, rotation and flip of the output.
+ * - Aborts if the PS is rotated or flipped (ROTATE1, HFLIP1, VFLIP1).
+ * - Supports the RGB formats, the YUV formats and CSC1 are not modelled.
+ * - Samples the nearest PS pixel when scaling, the hardware filter is not
+ *   modelled. The blending rounds down.
+ * - Writes no pixel if ENABLE_PS_AS_OUT or ENABLE_ROTATE0 is not set in CTRL,
+ *   they are the engines of the primary processing flow.
+ * - Loads CTRL to AS_CLRKEYHIGH from a NEXT command, the words after them are
+ *   the registers not modelled and are ignored. NEXT reads 0 after the load.
+ * - Resets all registers when SFTRST is written to CTRL_SET.
+ */
+
+/*******************************************************************************
+ * Register definitions
+ ******************************************************************************/
+
+#define __I  volatile const
+#define __O  volatile
+#define __IO volatile
+
+/*! @brief PXP registers, named and placed as in the device header. */
+typedef struct
+{
+    __IO uint32_t CTRL_[1]; /**< Control Register 0, offset: 0x0 */
+    __IO uint32_t CTRL_SET_[1];
+    __IO uint32_t CTRL_CLR_[1];
+    __IO uint32_t CTRL_TOG_[1];
+    __IO uint32_t STAT_[1]; /**< Status Register, offset: 0x10 */
+    __IO uint32_t STAT_SET_[1];
+    __IO uint32_t STAT_CLR_[1];
+    __IO uint32_t STAT_TOG_[1];
+    __IO uint32_t OUT_CTRL_[1]; /**< Output Buffer Control Register, offset: 0x20 */
+    __IO uint32_t OUT_CTRL_SET_[1];
+    __IO uint32_t OUT_CTRL_CLR_[1];
+    __IO uint32_t OUT_CTRL_TOG_[1];
+    __IO uint32_t OUT_BUF; /**< Output Frame Buffer Pointer, offset: 0x30 */
+    uint8_t RESERVED_0[12];
+    __IO uint32_t OUT_BUF2; /**< Output Frame Buffer Pointer #2, offset: 0x40 */
+    uint8_t RESERVED_1[12];
+    __IO uint32_t OUT_PITCH; /**< Output Buffer Pitch, offset: 0x50 */
+    uint8_t RESERVED_2[12];
+    __IO uint32_t OUT_LRC; /**< Output Surface Lower Right Coordinate, offset: 0x60 */
+    uint8_t RESERVED_3[12];
+    __IO uint32_t OUT_PS_ULC; /**< Processed Surface Upper Left Coordinate, offset: 0x70 */
+    uint8_t RESERVED_4[12];
+    __IO uint32_t OUT_PS_LRC; /**< Processed Surface Lower Right Coordinate, offset: 0x80 */
+    uint8_t RESERVED_5[12];
+    __IO uint32_t OUT_AS_ULC; /**< Alpha Surface Upper Left Coordinate, offset: 0x90 */
+    uint8_t RESERVED_6[12];
+    __IO uint32_t OUT_AS_LRC; /**< Alpha Surface Lower Right Coordinate, offset: 0xA0 */
+    uint8_t RESERVED_7[12];
+    __IO uint32_t PS_CTRL; /**< Processed Surface (PS) Control Register, offset: 0xB0 */
+    uint8_t RESERVED_8[12];
+    __IO uint32_t PS_BUF; /**< PS Input Buffer Address, offset: 0xC0 */
+    uint8_t RESERVED_9[12];
+    __IO uint32_t PS_UBUF; /**< PS U/Cb or 2 Plane UV Input Buffer Address, offset: 0xD0 */
+    uint8_t RESERVED_10[12];
+    __IO uint32_t PS_VBUF; /**< PS V/Cr Input Buffer Address, offset: 0xE0 */
+    uint8_t RESERVED_11[12];
+    __IO uint32_t PS_PITCH; /**< Processed Surface Pitch, offset: 0xF0 */
+    uint8_t RESERVED_12[12];
+    __IO uint32_t PS_BACKGROUND_0; /**< PS Background Color, offset: 0x100 */
+    uint8_t RESERVED_13[12];
+    __IO uint32_t PS_SCALE; /**< PS Scale Factor Register, offset: 0x110 */
+    uint8_t RESERVED_14[12];
+    __IO uint32_t PS_OFFSET; /**< PS Scale Offset Register, offset: 0x120 */
+    uint8_t RESERVED_15[12];
+    __IO uint32_t PS_CLRKEYLOW_0; /**< PS Color Key Low, offset: 0x130 */
+    uint8_t RESERVED_16[12];
+    __IO uint32_t PS_CLRKEYHIGH_0; /**< PS Color Key High, offset: 0x140 */
+    uint8_t RESERVED_17[12];
+    __IO uint32_t AS_CTRL; /**< Alpha Surface Control, offset: 0x150 */
+    uint8_t RESERVED_18[12];
+    __IO uint32_t AS_BUF; /**< Alpha Surface Buffer Pointer, offset: 0x160 */
+    uint8_t RESERVED_19[12];
+    __IO uint32_t AS_PITCH; /**< Alpha Surface Pitch, offset: 0x170 */
+    uint8_t RESERVED_20[12];
+    __IO uint32_t AS_CLRKEYLOW_0; /**< Overlay Color Key Low, offset: 0x180 */
+    uint8_t RESERVED_21[12];
+    __IO uint32_t AS_CLRKEYHIGH_0; /**< Overlay Color Key High, offset: 0x190 */
+    uint8_t RESERVED_22[12];
+    __IO uint32_t CSC1_COEF0; /**< Color Space Conversion Coefficient Register 0, offset: 0x1A0 */
+    uint8_t RESERVED_23[12];
+    __IO uint32_t CSC1_COEF1; /**< Color Space Conversion Coefficient Register 1, offset: 0x1B0 */
+    uint8_t RESERVED_24[12];
+    __IO uint32_t CSC1_COEF2; /**< Color Space Conversion Coefficient Register 2, offset: 0x1C0 */
+    uint8_t RESERVED_25[572];
+    __IO uint32_t NEXT_[1]; /**< Next Frame Pointer, offset: 0x400 */
+    uint8_t RESERVED_26[60];
+    __IO uint32_t PORTER_DUFF_CTRL; /**< PXP Alpha Engine A Control Register, offset: 0x440 */
+} PXP_Type;
+
+/* The accesses of these registers synchronize the model, see PXP_MODEL_Sync. */
+#define CTRL         CTRL_[PXP_MODEL_Sync()]
+#define CTRL_SET     CTRL_SET_[PXP_MODEL_Sync()]
+#define CTRL_CLR     CTRL_CLR_[PXP_MODEL_Sync()]
+#define CTRL_TOG     CTRL_TOG_[PXP_MODEL_Sync()]
+#define STAT         STAT_[PXP_MODEL_Sync()]
+#define STAT_SET     STAT_SET_[PXP_MODEL_Sync()]
+#define STAT_CLR     STAT_CLR_[PXP_MODEL_Sync()]
+#define STAT_TOG     STAT_TOG_[PXP_MODEL_Sync()]
+#define OUT_CTRL     OUT_CTRL_[PXP_MODEL_Sync()]
+#define OUT_CTRL_SET OUT_CTRL_SET_[PXP_MODEL_Sync()]
+#define OUT_CTRL_CLR OUT_CTRL_CLR_[PXP_MODEL_Sync()]
+#define OUT_CTRL_TOG OUT_CTRL_TOG_[PXP_MODEL_Sync()]
+#define NEXT         NEXT_[PXP_MODEL_Sync()]
+
+/* Register field value, shifted and masked. */
+#define PXP_MODEL_FIELD(field, x) (((uint32_t)(((uint32_t)(x)) << field##_SHIFT)) & field##_MASK)
+
+/* CTRL */
+#define PXP_CTRL_ENABLE_MASK                  (0x1U)
+#define PXP_CTRL_ENABLE_SHIFT                 (0U)
+#define PXP_CTRL_IRQ_ENABLE_MASK              (0x2U)
+#define PXP_CTRL_IRQ_ENABLE_SHIFT             (1U)
+#define PXP_CTRL_NEXT_IRQ_ENABLE_MASK         (0x4U)
+#define PXP_CTRL_NEXT_IRQ_ENABLE_SHIFT        (2U)
+#define PXP_CTRL_ENABLE_LCD0_HANDSHAKE_MASK   (0x10U)
+#define PXP_CTRL_ENABLE_LCD0_HANDSHAKE_SHIFT  (4U)
+#define PXP_CTRL_ROTATE0_MASK                 (0x300U)
+#define PXP_CTRL_ROTATE0_SHIFT                (8U)
+#define PXP_CTRL_ROTATE0(x)                   PXP_MODEL_FIELD(PXP_CTRL_ROTATE0, x)
+#define PXP_CTRL_HFLIP0_MASK                  (0x400U)
+#define PXP_CTRL_HFLIP0_SHIFT                 (10U)
+#define PXP_CTRL_VFLIP0_MASK                  (0x800U)
+#define PXP_CTRL_VFLIP0_SHIFT                 (11U)
+#define PXP_CTRL_ROTATE1_MASK                 (0x3000U)
+#define PXP_CTRL_ROTATE1_SHIFT                (12U)
+#define PXP_CTRL_ROTATE1(x)                   PXP_MODEL_FIELD(PXP_CTRL_ROTATE1, x)
+#define PXP_CTRL_HFLIP1_MASK                  (0x4000U)
+#define PXP_CTRL_HFLIP1_SHIFT                 (14U)
+#define PXP_CTRL_VFLIP1_MASK                  (0x8000U)
+#define PXP_CTRL_VFLIP1_SHIFT                 (15U)
+#define PXP_CTRL_ENABLE_PS_AS_OUT_MASK        (0x10000U)
+#define PXP_CTRL_ENABLE_PS_AS_OUT_SHIFT       (16U)
+#define PXP_CTRL_BLOCK_SIZE_MASK              (0x800000U)
+#define PXP_CTRL_BLOCK_SIZE_SHIFT             (23U)
+#define PXP_CTRL_BLOCK_SIZE(x)                PXP_MODEL_FIELD(PXP_CTRL_BLOCK_SIZE, x)
+#define PXP_CTRL_ENABLE_ROTATE0_MASK          (0x4000000U)
+#define PXP_CTRL_ENABLE_ROTATE0_SHIFT         (26U)
+#define PXP_CTRL_EN_REPEAT_MASK               (0x10000000U)
+#define PXP_CTRL_EN_REPEAT_SHIFT              (28U)
+#define PXP_CTRL_CLKGATE_MASK                 (0x40000000U)
+#define PXP_CTRL_CLKGATE_SHIFT                (30U)
+#define PXP_CTRL_SFTRST_MASK                  (0x80000000U)
+#define PXP_CTRL_SFTRST_SHIFT                 (31U)
+
+/* STAT */
+#define PXP_STAT_IRQ0_MASK               (0x1U)
+#define PXP_STAT_IRQ0_SHIFT              (0U)
+#define PXP_STAT_AXI_WRITE_ERROR_0_MASK  (0x2U)
+#define PXP_STAT_AXI_WRITE_ERROR_0_SHIFT (1U)
+#define PXP_STAT_AXI_READ_ERROR_0_MASK   (0x4U)
+#define PXP_STAT_AXI_READ_ERROR_0_SHIFT  (2U)
+#define PXP_STAT_NEXT_IRQ_MASK           (0x8U)
+#define PXP_STAT_NEXT_IRQ_SHIFT          (3U)
+#define PXP_STAT_AXI_ERROR_ID_MASK       (0xF0U)
+#define PXP_STAT_AXI_ERROR_ID_SHIFT      (4U)
+
+/* OUT_CTRL */
+#define PXP_OUT_CTRL_FORMAT_MASK             (0x1FU)
+#define PXP_OUT_CTRL_FORMAT_SHIFT            (0U)
+#define PXP_OUT_CTRL_FORMAT(x)               PXP_MODEL_FIELD(PXP_OUT_CTRL_FORMAT, x)
+#define PXP_OUT_CTRL_INTERLACED_OUTPUT_MASK  (0x300U)
+#define PXP_OUT_CTRL_INTERLACED_OUTPUT_SHIFT (8U)
+#define PXP_OUT_CTRL_INTERLACED_OUTPUT(x)    PXP_MODEL_FIELD(PXP_OUT_CTRL_INTERLACED_OUTPUT, x)
+#define PXP_OUT_CTRL_ALPHA_OUTPUT_MASK       (0x800000U)
+#define PXP_OUT_CTRL_ALPHA_OUTPUT_SHIFT      (23U)
+#define PXP_OUT_CTRL_ALPHA_MASK              (0xFF000000U)
+#define PXP_OUT_CTRL_ALPHA_SHIFT             (24U)
+#define PXP_OUT_CTRL_ALPHA(x)                PXP_MODEL_FIELD(PXP_OUT_CTRL_ALPHA, x)
+
+/* OUT_LRC, OUT_PS_ULC, OUT_PS_LRC, OUT_AS_ULC, OUT_AS_LRC */
+#define PXP_OUT_LRC_Y_MASK        (0x3FFFU)
+#define PXP_OUT_LRC_Y_SHIFT       (0U)
+#define PXP_OUT_LRC_Y(x)          PXP_MODEL_FIELD(PXP_OUT_LRC_Y, x)
+#define PXP_OUT_LRC_X_MASK        (0x3FFF0000U)
+#define PXP_OUT_LRC_X_SHIFT       (16U)
+#define PXP_OUT_LRC_X(x)          PXP_MODEL_FIELD(PXP_OUT_LRC_X, x)
+#define PXP_OUT_PS_ULC_Y_MASK     (0x3FFFU)
+#define PXP_OUT_PS_ULC_Y_SHIFT    (0U)
+#define PXP_OUT_PS_ULC_Y(x)       PXP_MODEL_FIELD(PXP_OUT_PS_ULC_Y, x)
+#define PXP_OUT_PS_ULC_X_MASK     (0x3FFF0000U)
+#define PXP_OUT_PS_ULC_X_SHIFT    (16U)
+#define PXP_OUT_PS_ULC_X(x)       PXP_MODEL_FIELD(PXP_OUT_PS_ULC_X, x)
+#define PXP_OUT_PS_LRC_Y_MASK     (0x3FFFU)
+#define PXP_OUT_PS_LRC_Y_SHIFT    (0U)
+#define PXP_OUT_PS_LRC_Y(x)       PXP_MODEL_FIELD(PXP_OUT_PS_LRC_Y, x)
+#define PXP_OUT_PS_LRC_X_MASK     (0x3FFF0000U)
+#define PXP_OUT_PS_LRC_X_SHIFT    (16U)
+#define PXP_OUT_PS_LRC_X(x)       PXP_MODEL_FIELD(PXP_OUT_PS_LRC_X, x)
+#define PXP_OUT_AS_ULC_Y_MASK     (0x3FFFU)
+#define PXP_OUT_AS_ULC_Y_SHIFT    (0U)
+#define PXP_OUT_AS_ULC_Y(x)       PXP_MODEL_FIELD(PXP_OUT_AS_ULC_Y, x)
+#define PXP_OUT_AS_ULC_X_MASK     (0x3FFF0000U)
+#define PXP_OUT_AS_ULC_X_SHIFT    (16U)
+#define PXP_OUT_AS_ULC_X(x)       PXP_MODEL_FIELD(PXP_OUT_AS_ULC_X, x)
+#define PXP_OUT_AS_LRC_Y_MASK     (0x3FFFU)
+#define PXP_OUT_AS_LRC_Y_SHIFT    (0U)
+#define PXP_OUT_AS_LRC_Y(x)       PXP_MODEL_FIELD(PXP_OUT_AS_LRC_Y, x)
+#define PXP_OUT_AS_LRC_X_MASK     (0x3FFF0000U)
+#define PXP_OUT_AS_LRC_X_SHIFT    (16U)
+#define PXP_OUT_AS_LRC_X(x)       PXP_MODEL_FIELD(PXP_OUT_AS_LRC_X, x)
+
+/* PS_CTRL */
+#define PXP_PS_CTRL_FORMAT_MASK   (0x3FU)
+#define PXP_PS_CTRL_FORMAT_SHIFT  (0U)
+#define PXP_PS_CTRL_FORMAT(x)     PXP_MODEL_FIELD(PXP_PS_CTRL_FORMAT, x)
+#define PXP_PS_CTRL_WB_SWAP_MASK  (0x40U)
+#define PXP_PS_CTRL_WB_SWAP_SHIFT (6U)
+#define PXP_PS_CTRL_WB_SWAP(x)    PXP_MODEL_FIELD(PXP_PS_CTRL_WB_SWAP, x)
+#define PXP_PS_CTRL_DECY_MASK     (0x300U)
+#define PXP_PS_CTRL_DECY_SHIFT    (8U)
+#define PXP_PS_CTRL_DECY(x)       PXP_MODEL_FIELD(PXP_PS_CTRL_DECY, x)
+#define PXP_PS_CTRL_DECX_MASK     (0xC00U)
+#define PXP_PS_CTRL_DECX_SHIFT    (10U)
+#define PXP_PS_CTRL_DECX(x)       PXP_MODEL_FIELD(PXP_PS_CTRL_DECX, x)
+
+/* PS_BACKGROUND_0, PS_SCALE, PS_OFFSET, PS_CLRKEYLOW_0, PS_CLRKEYHIGH_0 */
+#define PXP_PS_BACKGROUND_0_COLOR_MASK  (0xFFFFFFU)
+#define PXP_PS_BACKGROUND_0_COLOR_SHIFT (0U)
+#define PXP_PS_SCALE_XSCALE_MASK        (0x7FFFU)
+#define PXP_PS_SCALE_XSCALE_SHIFT       (0U)
+#define PXP_PS_SCALE_XSCALE(x)          PXP_MODEL_FIELD(PXP_PS_SCALE_XSCALE, x)
+#define PXP_PS_SCALE_YSCALE_MASK        (0x7FFF0000U)
+#define PXP_PS_SCALE_YSCALE_SHIFT       (16U)
+#define PXP_PS_SCALE_YSCALE(x)          PXP_MODEL_FIELD(PXP_PS_SCALE_YSCALE, x)
+#define PXP_PS_OFFSET_XOFFSET_MASK      (0xFFFU)
+#define PXP_PS_OFFSET_XOFFSET_SHIFT     (0U)
+#define PXP_PS_OFFSET_XOFFSET(x)        PXP_MODEL_FIELD(PXP_PS_OFFSET_XOFFSET, x)
+#define PXP_PS_OFFSET_YOFFSET_MASK      (0xFFF0000U)
+#define PXP_PS_OFFSET_YOFFSET_SHIFT     (16U)
+#define PXP_PS_OFFSET_YOFFSET(x)        PXP_MODEL_FIELD(PXP_PS_OFFSET_YOFFSET, x)
+#define PXP_PS_CLRKEYLOW_0_PIXEL_MASK   (0xFFFFFFU)
+#define PXP_PS_CLRKEYLOW_0_PIXEL_SHIFT  (0U)
+#define PXP_PS_CLRKEYHIGH_0_PIXEL_MASK  (0xFFFFFFU)
+#define PXP_PS_CLRKEYHIGH_0_PIXEL_SHIFT (0U)
+
+/* AS_CTRL, AS_CLRKEYLOW_0, AS_CLRKEYHIGH_0 */
+#define PXP_AS_CTRL_ALPHA_CTRL_MASK       (0x6U)
+#define PXP_AS_CTRL_ALPHA_CTRL_SHIFT      (1U)
+#define PXP_AS_CTRL_ALPHA_CTRL(x)         PXP_MODEL_FIELD(PXP_AS_CTRL_ALPHA_CTRL, x)
+#define PXP_AS_CTRL_ENABLE_COLORKEY_MASK  (0x8U)
+#define PXP_AS_CTRL_ENABLE_COLORKEY_SHIFT (3U)
+#define PXP_AS_CTRL_ENABLE_COLORKEY(x)    PXP_MODEL_FIELD(PXP_AS_CTRL_ENABLE_COLORKEY, x)
+#define PXP_AS_CTRL_FORMAT_MASK           (0xF0U)
+#define PXP_AS_CTRL_FORMAT_SHIFT          (4U)
+#define PXP_AS_CTRL_FORMAT(x)             PXP_MODEL_FIELD(PXP_AS_CTRL_FORMAT, x)
+#define PXP_AS_CTRL_ALPHA_MASK            (0xFF00U)
+#define PXP_AS_CTRL_ALPHA_SHIFT           (8U)
+#define PXP_AS_CTRL_ALPHA(x)              PXP_MODEL_FIELD(PXP_AS_CTRL_ALPHA, x)
+#define PXP_AS_CTRL_ROP_MASK              (0xF0000U)
+#define PXP_AS_CTRL_ROP_SHIFT             (16U)
+#define PXP_AS_CTRL_ROP(x)                PXP_MODEL_FIELD(PXP_AS_CTRL_ROP, x)
+#define PXP_AS_CTRL_ALPHA0_INVERT_MASK    (0x100000U)
+#define PXP_AS_CTRL_ALPHA0_INVERT_SHIFT   (20U)
+#define PXP_AS_CLRKEYLOW_0_PIXEL_MASK     (0xFFFFFFU)
+#define PXP_AS_CLRKEYLOW_0_PIXEL_SHIFT    (0U)
+#define PXP_AS_CLRKEYHIGH_0_PIXEL_MASK    (0xFFFFFFU)
+#define PXP_AS_CLRKEYHIGH_0_PIXEL_SHIFT   (0U)
+
+/* CSC1_COEF0, CSC1_COEF1, CSC1_COEF2, only kept for the driver. */
+#define PXP_CSC1_COEF0_Y_OFFSET_MASK    (0x1FFU)
+#define PXP_CSC1_COEF0_Y_OFFSET_SHIFT   (0U)
+#define PXP_CSC1_COEF0_Y_OFFSET(x)      PXP_MODEL_FIELD(PXP_CSC1_COEF0_Y_OFFSET, x)
+#define PXP_CSC1_COEF0_UV_OFFSET_MASK   (0x3FE00U)
+#define PXP_CSC1_COEF0_UV_OFFSET_SHIFT  (9U)
+#define PXP_CSC1_COEF0_UV_OFFSET(x)     PXP_MODEL_FIELD(PXP_CSC1_COEF0_UV_OFFSET, x)
+#define PXP_CSC1_COEF0_C0_MASK          (0x1FFC0000U)
+#define PXP_CSC1_COEF0_C0_SHIFT         (18U)
+#define PXP_CSC1_COEF0_C0(x)            PXP_MODEL_FIELD(PXP_CSC1_COEF0_C0, x)
+#define PXP_CSC1_COEF0_BYPASS_MASK      (0x40000000U)
+#define PXP_CSC1_COEF0_BYPASS_SHIFT     (30U)
+#define PXP_CSC1_COEF0_YCBCR_MODE_MASK  (0x80000000U)
+#define PXP_CSC1_COEF0_YCBCR_MODE_SHIFT (31U)
+#define PXP_CSC1_COEF1_C4_MASK          (0x7FFU)
+#define PXP_CSC1_COEF1_C4_SHIFT         (0U)
+#define PXP_CSC1_COEF1_C4(x)            PXP_MODEL_FIELD(PXP_CSC1_COEF1_C4, x)
+#define PXP_CSC1_COEF1_C1_MASK          (0x7FF0000U)
+#define PXP_CSC1_COEF1_C1_SHIFT         (16U)
+#define PXP_CSC1_COEF1_C1(x)            PXP_MODEL_FIELD(PXP_CSC1_COEF1_C1, x)
+#define PXP_CSC1_COEF2_C3_MASK          (0x7FFU)
+#define PXP_CSC1_COEF2_C3_SHIFT         (0U)
+#define PXP_CSC1_COEF2_C3(x)            PXP_MODEL_FIELD(PXP_CSC1_COEF2_C3, x)
+#define PXP_CSC1_COEF2_C2_MASK          (0x7FF0000U)
+#define PXP_CSC1_COEF2_C2_SHIFT         (16U)
+#define PXP_CSC1_COEF2_C2(x)            PXP_MODEL_FIELD(PXP_CSC1_COEF2_C2, x)
+
+/* NEXT */
+#define PXP_NEXT_ENABLED_MASK  (0x1U)
+#define PXP_NEXT_ENABLED_SHIFT (0U)
+#define PXP_NEXT_POINTER_MASK  (0xFFFFFFFCU)
+#define PXP_NEXT_POINTER_SHIFT (2U)
+
+/* PORTER_DUFF_CTRL */
+#define PXP_PORTER_DUFF_CTRL_POTER_DUFF_ENABLE_MASK  (0x1U)
+#define PXP_PORTER_DUFF_CTRL_POTER_DUFF_ENABLE_SHIFT (0U)
+#define PXP_PORTER_DUFF_CTRL_S0_S1_FACTOR_MODE_MASK  (0x6U)
+#define PXP_PORTER_DUFF_CTRL_S0_S1_FACTOR_MODE_SHIFT (1U)
+#define PXP_PORTER_DUFF_CTRL_S0_S1_FACTOR_MODE(x)    PXP_MODEL_FIELD(PXP_PORTER_DUFF_CTRL_S0_S1_FACTOR_MODE, x)
+#define PXP_PORTER_DUFF_CTRL_S0_GLOBAL_ALPHA_MODE_MASK  (0x18U)
+#define PXP_PORTER_DUFF_CTRL_S0_GLOBAL_ALPHA_MODE_SHIFT (3U)
+#define PXP_PORTER_DUFF_CTRL_S0_GLOBAL_ALPHA_MODE(x) \
+    PXP_MODEL_FIELD(PXP_PORTER_DUFF_CTRL_S0_GLOBAL_ALPHA_MODE, x)
+#define PXP_PORTER_DUFF_CTRL_S0_ALPHA_MODE_MASK      (0x20U)
+#define PXP_PORTER_DUFF_CTRL_S0_ALPHA_MODE_SHIFT     (5U)
+#define PXP_PORTER_DUFF_CTRL_S0_ALPHA_MODE(x)        PXP_MODEL_FIELD(PXP_PORTER_DUFF_CTRL_S0_ALPHA_MODE, x)
+#define PXP_PORTER_DUFF_CTRL_S0_COLOR_MODE_MASK      (0x40U)
+#define PXP_PORTER_DUFF_CTRL_S0_COLOR_MODE_SHIFT     (6U)
+#define PXP_PORTER_DUFF_CTRL_S0_COLOR_MODE(x)        PXP_MODEL_FIELD(PXP_PORTER_DUFF_CTRL_S0_COLOR_MODE, x)
+#define PXP_PORTER_DUFF_CTRL_S1_S0_FACTOR_MODE_MASK  (0x300U)
+#define PXP_PORTER_DUFF_CTRL_S1_S0_FACTOR_MODE_SHIFT (8U)
+#define PXP_PORTER_DUFF_CTRL_S1_S0_FACTOR_MODE(x)    PXP_MODEL_FIELD(PXP_PORTER_DUFF_CTRL_S1_S0_FACTOR_MODE, x)
+#define PXP_PORTER_DUFF_CTRL_S1_GLOBAL_ALPHA_MODE_MASK  (0xC00U)
+#define PXP_PORTER_DUFF_CTRL_S1_GLOBAL_ALPHA_MODE_SHIFT (10U)
+#define PXP_PORTER_DUFF_CTRL_S1_GLOBAL_ALPHA_MODE(x) \
+    PXP_MODEL_FIELD(PXP_PORTER_DUFF_CTRL_S1_GLOBAL_ALPHA_MODE, x)
+#define PXP_PORTER_DUFF_CTRL_S1_ALPHA_MODE_MASK      (0x1000U)
+#define PXP_PORTER_DUFF_CTRL_S1_ALPHA_MODE_SHIFT     (12U)
+#define PXP_PORTER_DUFF_CTRL_S1_ALPHA_MODE(x)        PXP_MODEL_FIELD(PXP_PORTER_DUFF_CTRL_S1_ALPHA_MODE, x)
+#define PXP_PORTER_DUFF_CTRL_S1_COLOR_MODE_MASK      (0x2000U)
+#define PXP_PORTER_DUFF_CTRL_S1_COLOR_MODE_SHIFT     (13U)
+#define PXP_PORTER_DUFF_CTRL_S1_COLOR_MODE(x)        PXP_MODEL_FIELD(PXP_PORTER_DUFF_CTRL_S1_COLOR_MODE, x)
+#define PXP_PORTER_DUFF_CTRL_S0_GLOBAL_ALPHA_MASK    (0xFF0000U)
+#define PXP_PORTER_DUFF_CTRL_S0_GLOBAL_ALPHA_SHIFT   (16U)
+#define PXP_PORTER_DUFF_CTRL_S1_GLOBAL_ALPHA_MASK    (0xFF000000U)
+#define PXP_PORTER_DUFF_CTRL_S1_GLOBAL_ALPHA_SHIFT   (24U)
+
+/*! @brief The only PXP instance. */
+extern PXP_Type g_pxpModelRegs;
+
+#define PXP           (&g_pxpModelRegs)
+#define PXP_BASE_PTRS {PXP}
+
+/*******************************************************************************
+ * Model API
+ ******************************************************************************/
+
+/*! @brief PXP interrupt handler, the entry of the vector table. */
+typedef void (*pxp_model_irq_handler_t)(void);
+
+/*! @brief Model counters. */
+typedef struct _pxp_model_stat
+{
+    uint32_t operations;   /*!< Operations done, with or without output. */
+    uint32_t commands;     /*!< Commands loaded from NEXT. */
+    uint32_t interrupts;   /*!< Interrupt handler calls. */
+    uint32_t dropped;      /*!< Operations without output, the processing engines were disabled. */
+    uint64_t pixelsOut;    /*!< Output pixels written. */
+    uint64_t bytesRead;    /*!< Bytes read from PS and AS. */
+    uint64_t bytesWritten; /*!< Bytes written to the output buffer. */
+} pxp_model_stat_t;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * @brief Power on reset, the registers get the reset value, the counters are cleared.
+ *
+ * The interrupt handler is removed, the interrupt is disabled in NVIC and not masked.
+ */
+void PXP_MODEL_Reset(void);
+
+/*!
+ * @brief Apply the register alias writes, run the pending operations, call the interrupt handler.
+ *
+ * Called by the register access macros, it could also be called directly to
+ * run the PXP.
+ *
+ * @return 0, used as array index by the register access macros.
+ */
+uint32_t PXP_MODEL_Sync(void);
+
+/*!
+ * @brief Set the interrupt handler, like a RAM vector table.
+ *
+ * @param handler The handler, NULL to remove.
+ * @return The previous handler.
+ */
+pxp_model_irq_handler_t PXP_MODEL_SetIRQHandler(pxp_model_irq_handler_t handler);
+
+/*!
+ * @brief Enable or disable the PXP interrupt in NVIC.
+ *
+ * @param enable True to enable.
+ */
+void PXP_MODEL_EnableIRQ(bool enable);
+
+/*!
+ * @brief Mask or unmask all interrupts, like PRIMASK.
+ *
+ * The pending interrupt is taken when unmasked.
+ *
+ * @param mask True to mask.
+ * @return True if it was masked.
+ */
+bool PXP_MODEL_MaskIRQ(bool mask);
+
+/*!
+ * @brief Get the model counters.
+ *
+ * @param stat Pointer to the counters.
+ */
+void PXP_MODEL_GetStat(pxp_model_stat_t *stat);
+
+/*!
+ * @brief Get the bus address of host memory.
+ *
+ * The memory must be below 4 GiB, the model aborts otherwise.
+ *
+ * @param ptr Host address.
+ * @return Bus address.
+ */
+uint32_t PXP_MODEL_Addr(const void *ptr);
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+#endif /* _PXP_MODEL_H_ */
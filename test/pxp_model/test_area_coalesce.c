@@ -0,0 +1,308 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "area_coalesce.h"
+#include "test_pxp.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define TEST_FRAME_WIDTH  720
+#define TEST_FRAME_HEIGHT 1280
+
+/* LV_INV_BUF_SIZE, the dirty area list limit of the port. */
+#define TEST_LIST_MAX 32U
+
+#define TEST_RANDOM_LISTS 500U
+
+/* Dirty areas of one frame. */
+typedef struct _test_trace
+{
+    const char *name;
+    uint32_t count;
+    demo_area_t areas[TEST_LIST_MAX];
+} test_trace_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+/*
+ * Cost models in the range measured by DEMO_CalibrateAreaCost: CPU copy, PXP
+ * copy with its setup and interrupt, CPU rotation with cache clean, and the two
+ * extremes.
+ */
+static const demo_area_cost_t s_costs[] = {
+    {300U, 256U},
+    {4000U, 77U},
+    {800U, 768U},
+    {1000U, 0U},
+    {0U, 256U},
+};
+
+static uint32_t s_seed = 1U;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static uint32_t TEST_Random(uint32_t max)
+{
+    s_seed = s_seed * 1103515245U + 12345U;
+
+    return (s_seed >> 8U) % (max + 1U);
+}
+
+static void TEST_SetArea(demo_area_t *area, int32_t x, int32_t y, int32_t width, int32_t height)
+{
+    area->x1 = x;
+    area->y1 = y;
+    area->x2 = MIN(x + width, TEST_FRAME_WIDTH) - 1;
+    area->y2 = MIN(y + height, TEST_FRAME_HEIGHT) - 1;
+}
+
+static void TEST_RandomArea(demo_area_t *area, uint32_t maxSide)
+{
+    TEST_SetArea(area, (int32_t)TEST_Random(TEST_FRAME_WIDTH - 1U), (int32_t)TEST_Random(TEST_FRAME_HEIGHT - 1U),
+                 (int32_t)TEST_Random(maxSide - 1U) + 1, (int32_t)TEST_Random(maxSide - 1U) + 1);
+}
+
+static bool TEST_IsAreaIn(const demo_area_t *inner, const demo_area_t *outer)
+{
+    return (inner->x1 >= outer->x1) && (inner->y1 >= outer->y1) && (inner->x2 <= outer->x2) && (inner->y2 <= outer->y2);
+}
+
+static uint64_t TEST_GetListCost(const demo_area_cost_t *cost, const demo_area_t *areas, uint32_t count)
+{
+    uint64_t sum = 0U;
+
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        sum += DEMO_GetAreaCost(cost, &areas[i]);
+    }
+
+    return sum;
+}
+
+/* Coalesce the trace and check the merged list, return the merged cost. */
+static uint64_t TEST_CheckTrace(const demo_area_cost_t *cost, const test_trace_t *trace, uint32_t *mergedCount)
+{
+    demo_area_t merged[TEST_LIST_MAX];
+    demo_area_t joined;
+    uint32_t count;
+    bool covered;
+
+    for (uint32_t i = 0U; i < trace->count; i++)
+    {
+        merged[i] = trace->areas[i];
+    }
+
+    count = DEMO_CoalesceAreas(cost, merged, trace->count);
+
+    /* Never more areas than the input, so never over the list limit. */
+    TEST_CHECK((count >= 1U) && (count <= trace->count) && (count <= TEST_LIST_MAX));
+
+    /* Every input area is in one merged area, and the merged areas are in the frame. */
+    for (uint32_t i = 0U; i < trace->count; i++)
+    {
+        covered = false;
+        for (uint32_t j = 0U; j < count; j++)
+        {
+            covered = covered || TEST_IsAreaIn(&trace->areas[i], &merged[j]);
+        }
+        TEST_CHECK(covered);
+    }
+
+    for (uint32_t j = 0U; j < count; j++)
+    {
+        TEST_CHECK((merged[j].x1 >= 0) && (merged[j].y1 >= 0) && (merged[j].x2 < TEST_FRAME_WIDTH) &&
+                   (merged[j].y2 < TEST_FRAME_HEIGHT));
+    }
+
+    /* Never more costly than the unmerged list. */
+    TEST_CHECK(TEST_GetListCost(cost, merged, count) <= TEST_GetListCost(cost, trace->areas, trace->count));
+
+    /* No pair is left to merge. */
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        for (uint32_t j = i + 1U; j < count; j++)
+        {
+            joined.x1 = MIN(merged[i].x1, merged[j].x1);
+            joined.y1 = MIN(merged[i].y1, merged[j].y1);
+            joined.x2 = MAX(merged[i].x2, merged[j].x2);
+            joined.y2 = MAX(merged[i].y2, merged[j].y2);
+            TEST_CHECK(DEMO_GetAreaCost(cost, &joined) >
+                       (DEMO_GetAreaCost(cost, &merged[i]) + DEMO_GetAreaCost(cost, &merged[j])));
+        }
+    }
+
+    *mergedCount = count;
+
+    return TEST_GetListCost(cost, merged, count);
+}
+
+/*
+ * Synthetic frames shaped like the lv_demo_benchmark scenes, no recorded trace
+ * is available on the host.
+ */
+static uint32_t TEST_MakeTraces(test_trace_t *traces)
+{
+    test_trace_t *trace = traces;
+
+    /* Moving rectangles. */
+    trace->name  = "rectangles";
+    trace->count = 20U;
+    for (uint32_t i = 0U; i < trace->count; i++)
+    {
+        TEST_RandomArea(&trace->areas[i], 120U);
+    }
+    trace++;
+
+    /* Text labels in a column. */
+    trace->name  = "text";
+    trace->count = 16U;
+    for (uint32_t i = 0U; i < trace->count; i++)
+    {
+        TEST_SetArea(&trace->areas[i], 40, 200 + (int32_t)i * 34, 200 + (int32_t)TEST_Random(400U), 24);
+    }
+    trace++;
+
+    /* Arc segments around a spinner. */
+    trace->name  = "spinner";
+    trace->count = 8U;
+    {
+        static const int8_t ring[8][2] = {{0, -2}, {1, -1}, {2, 0}, {1, 1}, {0, 2}, {-1, 1}, {-2, 0}, {-1, -1}};
+
+        for (uint32_t i = 0U; i < trace->count; i++)
+        {
+            TEST_SetArea(&trace->areas[i], 340 + ring[i][0] * 60, 620 + ring[i][1] * 60, 40, 40);
+        }
+    }
+    trace++;
+
+    /* Overlapping and nested large areas. */
+    trace->name  = "overlap";
+    trace->count = 4U;
+    TEST_SetArea(&trace->areas[0], 0, 0, 720, 400);
+    TEST_SetArea(&trace->areas[1], 100, 300, 500, 300);
+    TEST_SetArea(&trace->areas[2], 200, 100, 50, 50);
+    TEST_SetArea(&trace->areas[3], 0, 1000, 720, 280);
+    trace++;
+
+    /* Small widgets scattered over the screen, the list is full. */
+    trace->name  = "scattered";
+    trace->count = TEST_LIST_MAX;
+    for (uint32_t i = 0U; i < trace->count; i++)
+    {
+        TEST_SetArea(&trace->areas[i], (int32_t)(i % 4U) * 180 + 10, (int32_t)(i / 4U) * 160 + 10, 6, 6);
+    }
+    trace++;
+
+    /* A status bar and a scrolled list. */
+    trace->name  = "scroll";
+    trace->count = 3U;
+    TEST_SetArea(&trace->areas[0], 0, 0, 720, 48);
+    TEST_SetArea(&trace->areas[1], 0, 120, 720, 1000);
+    TEST_SetArea(&trace->areas[2], 600, 10, 100, 28);
+    trace++;
+
+    return (uint32_t)(trace - traces);
+}
+
+static void TEST_Traces(void)
+{
+    test_trace_t traces[8];
+    uint32_t traceCount = TEST_MakeTraces(traces);
+    uint32_t count;
+    uint64_t mergedCost;
+
+    for (uint32_t c = 0U; c < ARRAY_SIZE(s_costs); c++)
+    {
+        for (uint32_t t = 0U; t < traceCount; t++)
+        {
+            mergedCost = TEST_CheckTrace(&s_costs[c], &traces[t], &count);
+
+            (void)printf("cost %u+%u/256: %-10s %2u areas %8llu cycles -> %2u areas %8llu cycles\n",
+                         s_costs[c].fixedCycles, s_costs[c].pixelCycles256, traces[t].name, traces[t].count,
+                         (unsigned long long)TEST_GetListCost(&s_costs[c], traces[t].areas, traces[t].count), count,
+                         (unsigned long long)mergedCost);
+        }
+    }
+}
+
+static void TEST_RandomLists(void)
+{
+    test_trace_t trace = {.name = "random"};
+    demo_area_cost_t cost;
+    uint32_t count;
+
+    for (uint32_t n = 0U; n < TEST_RANDOM_LISTS; n++)
+    {
+        cost.fixedCycles    = TEST_Random(5000U);
+        cost.pixelCycles256 = TEST_Random(1024U);
+        trace.count         = TEST_Random(TEST_LIST_MAX - 1U) + 1U;
+
+        for (uint32_t i = 0U; i < trace.count; i++)
+        {
+            TEST_RandomArea(&trace.areas[i], (0U == (n & 1U)) ? 64U : 720U);
+        }
+
+        (void)TEST_CheckTrace(&cost, &trace, &count);
+    }
+}
+
+static void TEST_Merge(void)
+{
+    const demo_area_cost_t fixedOnly = {1000U, 0U};
+    const demo_area_cost_t pixelOnly = {0U, 256U};
+    demo_area_t areas[3];
+
+    /* Only the per area cost, all areas become one. */
+    TEST_SetArea(&areas[0], 0, 0, 10, 10);
+    TEST_SetArea(&areas[1], 700, 1200, 10, 10);
+    TEST_SetArea(&areas[2], 300, 600, 10, 10);
+    TEST_CHECK_EQUAL(1U, DEMO_CoalesceAreas(&fixedOnly, areas, 3U));
+    TEST_CHECK_EQUAL(0, areas[0].x1);
+    TEST_CHECK_EQUAL(0, areas[0].y1);
+    TEST_CHECK_EQUAL(709, areas[0].x2);
+    TEST_CHECK_EQUAL(1209, areas[0].y2);
+
+    /* Only the pixel cost, far areas stay, the nested one is merged. */
+    TEST_SetArea(&areas[0], 0, 0, 10, 10);
+    TEST_SetArea(&areas[1], 700, 1200, 10, 10);
+    TEST_SetArea(&areas[2], 2, 2, 4, 4);
+    TEST_CHECK_EQUAL(2U, DEMO_CoalesceAreas(&pixelOnly, areas, 3U));
+}
+
+static void TEST_FitCost(void)
+{
+    demo_area_cost_t cost;
+
+    /* 100 cycles per area and 2 cycles per pixel. */
+    DEMO_FitAreaCost(&cost, 64U, 100U + 128U, 8192U, 100U + 16384U);
+    TEST_CHECK_EQUAL(512U, cost.pixelCycles256);
+    TEST_CHECK_EQUAL(100U, cost.fixedCycles);
+
+    /* Measurement noise, the costs are never negative. */
+    DEMO_FitAreaCost(&cost, 64U, 500U, 8192U, 400U);
+    TEST_CHECK_EQUAL(0U, cost.pixelCycles256);
+    TEST_CHECK_EQUAL(500U, cost.fixedCycles);
+
+    DEMO_FitAreaCost(&cost, 64U, 10U, 8192U, 81920U);
+    TEST_CHECK_EQUAL(0U, cost.fixedCycles);
+}
+
+int main(void)
+{
+    TEST_RUN(TEST_FitCost());
+    TEST_RUN(TEST_Merge());
+    TEST_RUN(TEST_Traces());
+    TEST_RUN(TEST_RandomLists());
+
+    return TEST_RESULT();
+}
@@ -0,0 +1,231 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "beam_race.h"
+#include "test_pxp.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* RK055 panel timing, 60 Hz refresh. */
+#define TEST_ACTIVE_LINES 1280U
+#define TEST_BLANK_LINES  (16U + 2U + 14U)
+#define TEST_TOTAL_LINES  (TEST_ACTIVE_LINES + TEST_BLANK_LINES)
+#define TEST_PERIOD       (996000000U / 60U)
+
+/* Same band height as DEMO_BEAM_BAND_LINES. */
+#define TEST_BAND_LINES 80U
+#define TEST_BAND_COUNT (TEST_ACTIVE_LINES / TEST_BAND_LINES)
+
+/* The FreeRTOS tick, and the cost of one estimation when polling. */
+#define TEST_TICK_CYCLES (996000000U / 1000U)
+#define TEST_POLL_CYCLES 300U
+
+/* Scanout simulation. */
+typedef struct _test_scanout
+{
+    uint64_t vsync0;     /* Time of the vertical blanking interrupt of scan 0. */
+    uint32_t latencyMax; /* Max interrupt latency, the timestamp is taken late. */
+} test_scanout_t;
+
+/* Renderer simulation, in CPU cycles. */
+typedef struct _test_render
+{
+    uint32_t renderMin; /* Render time of one band. */
+    uint32_t renderMax;
+    uint32_t copyLine; /* Copy time of one band line. */
+    uint32_t frames;
+} test_render_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static const demo_beam_timing_t s_timing = {
+    .activeLines = TEST_ACTIVE_LINES,
+    .blankLines  = TEST_BLANK_LINES,
+};
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/* Reproducible pseudo random number in 0 ~ max. */
+static uint32_t TEST_Random(uint64_t key, uint32_t max)
+{
+    uint64_t x = key * 0x9E3779B97F4A7C15ULL;
+
+    x ^= x >> 29U;
+    x *= 0xBF58476D1CE4E5B9ULL;
+    x ^= x >> 32U;
+
+    return (uint32_t)(x % ((uint64_t)max + 1U));
+}
+
+/* Time the interrupt of scan k is handled. */
+static uint64_t TEST_VsyncIsrTime(const test_scanout_t *scanout, uint64_t k)
+{
+    return scanout->vsync0 + k * TEST_PERIOD + TEST_Random(k, scanout->latencyMax);
+}
+
+/* The timestamp and the period recorded by the vertical blanking ISR at time t. */
+static void TEST_GetVsync(const test_scanout_t *scanout, uint64_t t, uint32_t *vsyncCycle, uint32_t *vsyncPeriod)
+{
+    uint64_t k = (t - scanout->vsync0) / TEST_PERIOD;
+
+    if (TEST_VsyncIsrTime(scanout, k) > t)
+    {
+        k--;
+    }
+
+    *vsyncCycle  = (uint32_t)TEST_VsyncIsrTime(scanout, k);
+    *vsyncPeriod = (uint32_t)(TEST_VsyncIsrTime(scanout, k) - TEST_VsyncIsrTime(scanout, k - 1U));
+}
+
+/* Lines scanned out since row 0 of scan 0, the vertical blanking comes first. */
+static uint64_t TEST_GetLine(const test_scanout_t *scanout, uint64_t t)
+{
+    return (t - scanout->vsync0) * TEST_TOTAL_LINES / TEST_PERIOD - TEST_BLANK_LINES;
+}
+
+static void TEST_ScanLine(void)
+{
+    uint32_t vsync = 0xFFFFF000U;
+
+    TEST_CHECK_EQUAL((uint32_t)-(int32_t)TEST_BLANK_LINES,
+                     (uint32_t)DEMO_BeamGetScanLine(&s_timing, vsync, TEST_PERIOD, vsync));
+    /* The CPU cycle counter wraps. */
+    TEST_CHECK_EQUAL(0U, (uint32_t)DEMO_BeamGetScanLine(&s_timing, vsync, TEST_PERIOD,
+                                                         vsync + TEST_PERIOD / TEST_TOTAL_LINES * TEST_BLANK_LINES + 1000U));
+    TEST_CHECK_EQUAL(TEST_ACTIVE_LINES - 1U,
+                     (uint32_t)DEMO_BeamGetScanLine(&s_timing, vsync, TEST_PERIOD, vsync + TEST_PERIOD - 1U));
+    /* The interrupt is delayed, the next scan is estimated. */
+    TEST_CHECK_EQUAL((uint32_t)-(int32_t)TEST_BLANK_LINES,
+                     (uint32_t)DEMO_BeamGetScanLine(&s_timing, vsync, TEST_PERIOD, vsync + TEST_PERIOD));
+    /* Not measured, all rows passed. */
+    TEST_CHECK_EQUAL(TEST_ACTIVE_LINES, (uint32_t)DEMO_BeamGetScanLine(&s_timing, vsync, 0U, vsync));
+}
+
+static void TEST_WaitCycles(void)
+{
+    uint32_t vsync   = 0U;
+    uint32_t perLine = TEST_PERIOD / TEST_TOTAL_LINES;
+    uint32_t row0    = vsync + (TEST_PERIOD * (uint64_t)TEST_BLANK_LINES + TEST_TOTAL_LINES - 1U) / TEST_TOTAL_LINES;
+    uint32_t wait;
+
+    /* In the vertical blanking, the last band is passed. */
+    TEST_CHECK_EQUAL(0U, DEMO_BeamGetWaitCycles(&s_timing, vsync, TEST_PERIOD, vsync + perLine * (DEMO_BEAM_MARGIN_LINES + 2U),
+                                                TEST_ACTIVE_LINES - TEST_BAND_LINES, TEST_ACTIVE_LINES - 1U));
+
+    /* The first band is passed too, but the copy won't end before row 0 is scanned out. */
+    wait = DEMO_BeamGetWaitCycles(&s_timing, vsync, TEST_PERIOD, vsync, 0, TEST_BAND_LINES - 1U);
+    TEST_CHECK(wait >= (TEST_BLANK_LINES + TEST_BAND_LINES + DEMO_BEAM_MARGIN_LINES) * perLine);
+    TEST_CHECK_EQUAL(0U, DEMO_BeamGetWaitCycles(&s_timing, vsync, TEST_PERIOD, vsync + wait, 0, TEST_BAND_LINES - 1U));
+
+    /* The scanout is far above the band, still wait until the band is passed. */
+    wait = DEMO_BeamGetWaitCycles(&s_timing, vsync, TEST_PERIOD, row0, 800, 879);
+    TEST_CHECK(wait >= (879U + DEMO_BEAM_MARGIN_LINES) * perLine);
+    TEST_CHECK_EQUAL(0U, DEMO_BeamGetWaitCycles(&s_timing, vsync, TEST_PERIOD, row0 + wait, 800, 879));
+    TEST_CHECK(0U != DEMO_BeamGetWaitCycles(&s_timing, vsync, TEST_PERIOD, row0 + wait - perLine, 800, 879));
+
+    /* Not measured, nothing to wait. */
+    TEST_CHECK_EQUAL(0U, DEMO_BeamGetWaitCycles(&s_timing, vsync, 0U, row0, 800, 879));
+}
+
+/*
+ * Render the bands and copy them as DEMO_CopyBand does, against a simulated
+ * scanout. When a band copy starts, the scanout must have passed its last row,
+ * and it must not come back to the band before the copy ends.
+ */
+static void TEST_Scanout(const test_scanout_t *scanout, const test_render_t *render)
+{
+    /* Start after two interrupts, the period is measured then. */
+    uint64_t now = scanout->vsync0 + TEST_PERIOD * 2U + scanout->latencyMax;
+    uint64_t key = 0U;
+    uint32_t violations = 0U;
+    uint64_t maxWait = 0U;
+    uint32_t vsyncCycle, vsyncPeriod, wait;
+    uint64_t start, end, line;
+
+    for (uint32_t frame = 0U; frame < render->frames; frame++)
+    {
+        for (uint32_t band = 0U; band < TEST_BAND_COUNT; band++)
+        {
+            uint32_t y1 = band * TEST_BAND_LINES;
+            uint32_t y2 = y1 + TEST_BAND_LINES - 1U;
+
+            now += render->renderMin + TEST_Random(++key, render->renderMax - render->renderMin);
+            start = now;
+
+            for (;;)
+            {
+                TEST_GetVsync(scanout, now, &vsyncCycle, &vsyncPeriod);
+                wait = DEMO_BeamGetWaitCycles(&s_timing, vsyncCycle, vsyncPeriod, (uint32_t)now, (int32_t)y1,
+                                              (int32_t)y2);
+                if (0U == wait)
+                {
+                    break;
+                }
+
+                /* Same as DEMO_WaitBeamPassed, sleep whole ticks, otherwise poll. */
+                if (wait >= TEST_TICK_CYCLES)
+                {
+                    now += (uint64_t)(wait / TEST_TICK_CYCLES) * TEST_TICK_CYCLES;
+                }
+                else
+                {
+                    now += TEST_POLL_CYCLES;
+                }
+            }
+
+            maxWait = MAX(maxWait, now - start);
+
+            start = now;
+            end   = now + (uint64_t)TEST_BAND_LINES * render->copyLine;
+            line  = TEST_GetLine(scanout, start);
+
+            /* Passed the band in this scan, and not back to it in the next. */
+            if (((line % TEST_TOTAL_LINES) <= y2) ||
+                (TEST_GetLine(scanout, end) >= (line / TEST_TOTAL_LINES + 1U) * TEST_TOTAL_LINES + y1))
+            {
+                if (0U == violations)
+                {
+                    (void)printf("frame %u band %u copied at scan line %llu\n", frame, band,
+                                 (unsigned long long)(line % TEST_TOTAL_LINES));
+                }
+                violations++;
+            }
+
+            now = end;
+        }
+    }
+
+    TEST_CHECK_EQUAL(0U, violations);
+    /* Never wait more than one period for a band. */
+    TEST_CHECK(maxWait <= TEST_PERIOD);
+}
+
+int main(void)
+{
+    /* One band line is copied in 1/4 of its scanout time, 12.7 us per line at 60 Hz. */
+    test_render_t fast = {.renderMin = 1000U, .renderMax = 20000U, .copyLine = 3000U, .frames = 60U};
+    /* Slower than the scanout, bands fall into the next scan. */
+    test_render_t slow = {.renderMin = 500000U, .renderMax = 2500000U, .copyLine = 3000U, .frames = 60U};
+    test_scanout_t exact   = {.vsync0 = 0x100000000ULL - TEST_PERIOD * 3U, .latencyMax = 0U};
+    /* Up to 10 us interrupt latency. */
+    test_scanout_t jitter = {.vsync0 = 12345U, .latencyMax = 9960U};
+
+    TEST_RUN(TEST_ScanLine());
+    TEST_RUN(TEST_WaitCycles());
+    TEST_RUN(TEST_Scanout(&exact, &fast));
+    TEST_RUN(TEST_Scanout(&exact, &slow));
+    TEST_RUN(TEST_Scanout(&jitter, &fast));
+    TEST_RUN(TEST_Scanout(&jitter, &slow));
+
+    return TEST_RESULT();
+}
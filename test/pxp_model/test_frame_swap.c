@@ -0,0 +1,323 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Asynchronous flush of lvgl_support.c on a stub display controller. The stub
+ * reports the buffer switch off from a timer thread some time after the frame
+ * buffer is passed, like the vertical blanking interrupt. The switch off
+ * callback stands for DEMO_BufferSwitchOffCallback, which reports the LVGL
+ * flush ready, and DEMO_FrameSwapWaitFrame is the LVGL flush wait callback.
+ */
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "frame_swap.h"
+#include "test_pxp.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define TEST_FRAME_COUNT 200U
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static dc_fb_callback_t s_stubCallback;
+static void *s_stubParam;
+static pthread_t s_stubThread;
+static bool s_stubThreadRunning;
+/* Delay from setFrameBuffer to the switch off, 0 reports it in setFrameBuffer. */
+static uint32_t s_stubDelayUs;
+/* Buffer shown and the one passed but not shown yet. */
+static void *volatile s_stubShown;
+static void *volatile s_stubNext;
+static volatile uint32_t s_stubSwitchOffCount;
+static volatile uint64_t s_stubSwitchOffTime;
+
+static volatile uint32_t s_flushReadyCount;
+static volatile bool s_flushReadyEarly;
+static void *volatile s_flushReadyBuffer;
+
+static uint32_t s_frameBuffer[2];
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static uint64_t TEST_GetTimeUs(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000U + (uint64_t)ts.tv_nsec / 1000U;
+}
+
+static void TEST_SleepUs(uint32_t us)
+{
+    struct timespec ts = {.tv_sec = us / 1000000U, .tv_nsec = (long)(us % 1000000U) * 1000L};
+
+    (void)nanosleep(&ts, NULL);
+}
+
+/* The vertical blanking, the next buffer is shown and the shown one is switched off. */
+static void TEST_StubSwitchOff(void)
+{
+    void *switchOffBuffer = s_stubShown;
+
+    s_stubShown          = s_stubNext;
+    s_stubSwitchOffTime  = TEST_GetTimeUs();
+    s_stubSwitchOffCount = s_stubSwitchOffCount + 1U;
+
+    s_stubCallback(s_stubParam, switchOffBuffer);
+}
+
+static void *TEST_StubTimerThread(void *arg)
+{
+    (void)arg;
+
+    TEST_SleepUs(s_stubDelayUs);
+    TEST_StubSwitchOff();
+
+    return NULL;
+}
+
+static void TEST_StubJoin(void)
+{
+    if (s_stubThreadRunning)
+    {
+        (void)pthread_join(s_stubThread, NULL);
+        s_stubThreadRunning = false;
+    }
+}
+
+static status_t TEST_StubSetFrameBuffer(const dc_fb_t *dc, uint8_t layer, void *frameBuffer)
+{
+    (void)dc;
+    (void)layer;
+
+    TEST_StubJoin();
+
+    s_stubNext = frameBuffer;
+
+    if (s_stubDelayUs == 0U)
+    {
+        TEST_StubSwitchOff();
+    }
+    else
+    {
+        if (pthread_create(&s_stubThread, NULL, TEST_StubTimerThread, NULL) != 0)
+        {
+            abort();
+        }
+        s_stubThreadRunning = true;
+    }
+
+    return kStatus_Success;
+}
+
+static void TEST_StubSetCallback(const dc_fb_t *dc, uint8_t layer, dc_fb_callback_t callback, void *param)
+{
+    (void)dc;
+    (void)layer;
+
+    s_stubCallback = callback;
+    s_stubParam    = param;
+}
+
+static const dc_fb_ops_t s_stubOps = {
+    .setFrameBuffer = TEST_StubSetFrameBuffer,
+    .setCallback    = TEST_StubSetCallback,
+};
+
+static const dc_fb_t s_stubDc = {
+    .ops = &s_stubOps,
+};
+
+/* Stands for DEMO_BufferSwitchOffCallback reporting the LVGL flush ready. */
+static void TEST_FlushReady(void *param, void *switchOffBuffer)
+{
+    (void)param;
+
+    /* Widen the window if the waiting task were released before the flush ready. */
+    TEST_SleepUs(100U);
+
+    s_flushReadyCount = s_flushReadyCount + 1U;
+    if (s_flushReadyCount != s_stubSwitchOffCount)
+    {
+        s_flushReadyEarly = true;
+    }
+    s_flushReadyBuffer = switchOffBuffer;
+}
+
+static void TEST_Init(demo_frame_swap_t *swap, uint32_t delayUs)
+{
+    memset(swap, 0, sizeof(*swap));
+
+    s_stubDelayUs        = delayUs;
+    s_stubShown          = &s_frameBuffer[1];
+    s_stubNext           = &s_frameBuffer[1];
+    s_stubSwitchOffCount = 0U;
+    s_flushReadyCount    = 0U;
+    s_flushReadyEarly    = false;
+    s_flushReadyBuffer   = NULL;
+
+    TEST_CHECK_EQUAL(kStatus_Success, DEMO_FrameSwapInit(swap, &s_stubDc, 0U, TEST_FlushReady, NULL));
+    TEST_CHECK(s_stubCallback != NULL);
+    TEST_CHECK(s_stubParam == swap);
+}
+
+/* The flush ready is reported in the switch off, the flush wait blocks until then. */
+static void TEST_FlushReadyAfterSwitchOff(void)
+{
+    demo_frame_swap_t swap;
+    uint64_t waitDone;
+
+    TEST_Init(&swap, 50000U);
+
+    DEMO_FrameSwapSubmit(&swap, &s_frameBuffer[0]);
+    TEST_SleepUs(10000U);
+
+    /* Still scanning out the old buffer. */
+    TEST_CHECK(swap.framePending);
+    TEST_CHECK_EQUAL(0U, s_stubSwitchOffCount);
+    TEST_CHECK_EQUAL(0U, s_flushReadyCount);
+
+    DEMO_FrameSwapWaitFrame(&swap);
+    waitDone = TEST_GetTimeUs();
+
+    TEST_CHECK_EQUAL(1U, s_stubSwitchOffCount);
+    TEST_CHECK_EQUAL(1U, s_flushReadyCount);
+    TEST_CHECK(!s_flushReadyEarly);
+    TEST_CHECK(waitDone >= s_stubSwitchOffTime);
+    TEST_CHECK(s_flushReadyBuffer == &s_frameBuffer[1]);
+    TEST_CHECK(!swap.framePending);
+
+    /* Nothing pending, no wait. */
+    DEMO_FrameSwapWaitFrame(&swap);
+
+    TEST_StubJoin();
+}
+
+/* A switch off left from an earlier frame doesn't release the wait for the pending one. */
+static void TEST_StaleSwitchOff(void)
+{
+    demo_frame_swap_t swap;
+    uint64_t waitDone;
+
+    TEST_Init(&swap, 30000U);
+
+    /* Like the first frame buffer shown at init when nobody waits. */
+    TEST_StubSwitchOff();
+    TEST_CHECK_EQUAL(1U, s_flushReadyCount);
+
+    DEMO_FrameSwapSubmit(&swap, &s_frameBuffer[0]);
+    DEMO_FrameSwapWaitFrame(&swap);
+    waitDone = TEST_GetTimeUs();
+
+    TEST_CHECK_EQUAL(2U, s_stubSwitchOffCount);
+    TEST_CHECK_EQUAL(2U, s_flushReadyCount);
+    TEST_CHECK(!s_flushReadyEarly);
+    TEST_CHECK(waitDone >= s_stubSwitchOffTime);
+    TEST_CHECK(s_stubShown == &s_frameBuffer[0]);
+
+    TEST_StubJoin();
+}
+
+/* The switch off is reported before setFrameBuffer returns. */
+static void TEST_ImmediateSwitchOff(void)
+{
+    demo_frame_swap_t swap;
+
+    TEST_Init(&swap, 0U);
+
+    DEMO_FrameSwapSubmit(&swap, &s_frameBuffer[0]);
+
+    TEST_CHECK(!swap.framePending);
+    TEST_CHECK_EQUAL(1U, s_flushReadyCount);
+    TEST_CHECK(s_stubShown == &s_frameBuffer[0]);
+}
+
+/* The synchronous flush waits for the switch off of the buffer just passed. */
+static void TEST_SyncFlush(void)
+{
+    demo_frame_swap_t swap;
+    uint64_t waitDone;
+
+    memset(&swap, 0, sizeof(swap));
+    s_stubDelayUs        = 20000U;
+    s_stubShown          = &s_frameBuffer[1];
+    s_stubSwitchOffCount = 0U;
+
+    TEST_CHECK_EQUAL(kStatus_Success, DEMO_FrameSwapInit(&swap, &s_stubDc, 0U, NULL, NULL));
+
+    (void)s_stubDc.ops->setFrameBuffer(&s_stubDc, 0U, &s_frameBuffer[0]);
+    DEMO_FrameSwapWaitSwitchOff(&swap);
+    waitDone = TEST_GetTimeUs();
+
+    TEST_CHECK_EQUAL(1U, s_stubSwitchOffCount);
+    TEST_CHECK(waitDone >= s_stubSwitchOffTime);
+
+    TEST_StubJoin();
+}
+
+/*
+ * LVGL double buffering: wait for the flush, draw the buffer not shown, flush
+ * it. The drawn buffer must never be the one shown or pending.
+ */
+static void TEST_DoubleBuffer(void)
+{
+    demo_frame_swap_t swap;
+    uint32_t drawn = 0U;
+    uint32_t i;
+
+    TEST_Init(&swap, 1U);
+    srand(1U);
+
+    for (i = 0U; i < TEST_FRAME_COUNT; i++)
+    {
+        void *drawBuffer = &s_frameBuffer[drawn];
+
+        /* flush_wait_cb before LVGL renders in the buffer. */
+        DEMO_FrameSwapWaitFrame(&swap);
+
+        TEST_CHECK(s_stubShown != drawBuffer);
+        TEST_CHECK(s_stubNext != drawBuffer);
+        TEST_CHECK_EQUAL(i, s_flushReadyCount);
+
+        /* Up to 2 ms, sometimes reported in setFrameBuffer. */
+        s_stubDelayUs = ((i % 8U) == 0U) ? 0U : (uint32_t)rand() % 2000U + 1U;
+
+        DEMO_FrameSwapSubmit(&swap, drawBuffer);
+
+        /* LVGL swaps the draw buffers after the flush. */
+        drawn ^= 1U;
+    }
+
+    DEMO_FrameSwapWaitFrame(&swap);
+
+    TEST_CHECK_EQUAL(TEST_FRAME_COUNT, s_stubSwitchOffCount);
+    TEST_CHECK_EQUAL(TEST_FRAME_COUNT, s_flushReadyCount);
+    TEST_CHECK(!s_flushReadyEarly);
+
+    TEST_StubJoin();
+}
+
+int main(void)
+{
+    TEST_RUN(TEST_FlushReadyAfterSwitchOff());
+    TEST_RUN(TEST_StaleSwitchOff());
+    TEST_RUN(TEST_ImmediateSwitchOff());
+    TEST_RUN(TEST_SyncFlush());
+    TEST_RUN(TEST_DoubleBuffer());
+
+    return TEST_RESULT();
+}
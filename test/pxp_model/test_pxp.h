@@ -0,0 +1,53 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _TEST_PXP_H_
+#define _TEST_PXP_H_
+
+#include <stdio.h>
+
+/*
+ * Minimal checks for the host tests. A failed check is printed and counted,
+ * the test continues, main returns TEST_RESULT() as the exit code.
+ */
+
+static unsigned int s_testFailures;
+
+#define TEST_CHECK(cond)                                                               \
+    do                                                                                 \
+    {                                                                                  \
+        if (!(cond))                                                                   \
+        {                                                                              \
+            (void)printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond);      \
+            s_testFailures++;                                                          \
+        }                                                                              \
+    } while (0)
+
+#define TEST_CHECK_EQUAL(expect, actual)                                                                   \
+    do                                                                                                     \
+    {                                                                                                      \
+        unsigned long long expect_ = (unsigned long long)(expect);                                         \
+        unsigned long long actual_ = (unsigned long long)(actual);                                         \
+        if (expect_ != actual_)                                                                            \
+        {                                                                                                  \
+            (void)printf("%s:%d: %s: expected 0x%llx, got 0x%llx\n", __FILE__, __LINE__, #actual, expect_, \
+                         actual_);                                                                         \
+            s_testFailures++;                                                                              \
+        }                                                                                                  \
+    } while (0)
+
+#define TEST_RUN(test)                                                              \
+    do                                                                              \
+    {                                                                               \
+        unsigned int failures_ = s_testFailures;                                    \
+        test;                                                                       \
+        (void)printf("%s %s\n", (failures_ == s_testFailures) ? "PASS" : "FAIL", #test); \
+    } while (0)
+
+#define TEST_RESULT() ((0U == s_testFailures) ? 0 : 1)
+
+#endif /* _TEST_PXP_H_ */
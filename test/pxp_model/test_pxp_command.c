@@ -0,0 +1,293 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "pxp_command.h"
+#include "rotate_support.h"
+#include "test_pxp.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define TEST_WIDTH  24U
+#define TEST_HEIGHT 16U
+
+/* Bus addresses and pitches used by the register image checks. */
+#define TEST_DEST_ADDR  0x20000000U
+#define TEST_DEST_PITCH 1600U
+#define TEST_SRC_ADDR   0x80000000U
+#define TEST_SRC_PITCH  960U
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static uint16_t s_src[TEST_HEIGHT][TEST_WIDTH];
+static uint16_t s_dest[TEST_WIDTH][TEST_WIDTH];
+static uint16_t s_ref[TEST_WIDTH][TEST_WIDTH];
+static uint32_t s_src8888[TEST_HEIGHT][TEST_WIDTH];
+static uint32_t s_dest8888[TEST_HEIGHT][TEST_WIDTH];
+static demo_pxp_cmd_t s_cmd;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void TEST_CheckCmd(const uint32_t *expect, const demo_pxp_cmd_t *cmd)
+{
+    uint32_t i;
+
+    for (i = 0U; i < DEMO_PXP_CMD_WORDS; i++)
+    {
+        if (expect[i] != cmd->reg[i])
+        {
+            (void)printf("word %u: ", (unsigned int)i);
+            TEST_CHECK_EQUAL(expect[i], cmd->reg[i]);
+        }
+    }
+}
+
+/* Start the command, the model runs it at once. */
+static void TEST_RunCmd(demo_pxp_cmd_t *cmd)
+{
+    PXP_SetNextCommand(PXP, cmd);
+
+    TEST_CHECK(!PXP_IsNextCommandPending(PXP));
+    TEST_CHECK_EQUAL((uint32_t)kPXP_CompleteFlag | (uint32_t)kPXP_CommandLoadFlag,
+                     PXP_GetStatusFlags(PXP) & ((uint32_t)kPXP_CompleteFlag | (uint32_t)kPXP_CommandLoadFlag));
+
+    PXP_ClearStatusFlags(PXP, (uint32_t)kPXP_CompleteFlag | (uint32_t)kPXP_CommandLoadFlag);
+}
+
+static void TEST_InitBuffer(void)
+{
+    uint32_t x, y;
+
+    for (y = 0U; y < TEST_HEIGHT; y++)
+    {
+        for (x = 0U; x < TEST_WIDTH; x++)
+        {
+            s_src[y][x]     = (uint16_t)((y << 11U) | (x << 5U) | ((x + y) & 0x1FU));
+            s_src8888[y][x] = 0xFF000000U | (y << 18U) | (x << 10U) | (x ^ y);
+        }
+    }
+
+    (void)memset(s_dest, 0xA5, sizeof(s_dest));
+    (void)memset(s_ref, 0xA5, sizeof(s_ref));
+}
+
+static void TEST_RectImage(void)
+{
+    uint32_t expect[DEMO_PXP_CMD_WORDS] = {
+        [kDEMO_PXP_CmdCtrl]        = 0x04010103U,
+        [kDEMO_PXP_CmdOutCtrl]     = 0x0000000EU,
+        [kDEMO_PXP_CmdOutPsUlc]    = 0x3FFF3FFFU,
+        [kDEMO_PXP_CmdPsScale]     = 0x10001000U,
+        [kDEMO_PXP_CmdPsClrKeyLow] = 0x00FFFFFFU,
+        [kDEMO_PXP_CmdAsCtrl]      = 0x000300E6U,
+        [kDEMO_PXP_CmdAsClrKeyLow] = 0x00FFFFFFU,
+    };
+    demo_pxp_cmd_t constCmd = DEMO_PXP_CMD_RECT_INIT(kPXP_AsPixelFormatRGB565, kPXP_Rotate90);
+
+    TEST_CheckCmd(expect, &constCmd);
+
+    (void)memset(&s_cmd, 0x5A, sizeof(s_cmd));
+    DEMO_PXP_CmdInitRect(&s_cmd, kPXP_AsPixelFormatRGB565, kPXP_Rotate90);
+    TEST_CheckCmd(expect, &s_cmd);
+
+    DEMO_PXP_CmdSetRect(&s_cmd, TEST_DEST_ADDR, TEST_DEST_PITCH, TEST_SRC_ADDR, TEST_SRC_PITCH, TEST_WIDTH,
+                        TEST_HEIGHT);
+
+    expect[kDEMO_PXP_CmdOutBuf]   = TEST_DEST_ADDR;
+    expect[kDEMO_PXP_CmdOutPitch] = TEST_DEST_PITCH;
+    expect[kDEMO_PXP_CmdOutLrc]   = 0x0017000FU;
+    expect[kDEMO_PXP_CmdOutAsLrc] = 0x0017000FU;
+    expect[kDEMO_PXP_CmdAsBuf]    = TEST_SRC_ADDR;
+    expect[kDEMO_PXP_CmdAsPitch]  = TEST_SRC_PITCH;
+    TEST_CheckCmd(expect, &s_cmd);
+}
+
+static void TEST_BlendImage(void)
+{
+    uint32_t expect[DEMO_PXP_CMD_WORDS] = {
+        [kDEMO_PXP_CmdCtrl]        = 0x04010003U,
+        [kDEMO_PXP_CmdOutCtrl]     = 0x00000000U,
+        [kDEMO_PXP_CmdOutBuf]      = TEST_DEST_ADDR,
+        [kDEMO_PXP_CmdOutPitch]    = TEST_DEST_PITCH,
+        [kDEMO_PXP_CmdOutLrc]      = 0x0017000FU,
+        [kDEMO_PXP_CmdOutPsLrc]    = 0x0017000FU,
+        [kDEMO_PXP_CmdOutAsLrc]    = 0x0017000FU,
+        [kDEMO_PXP_CmdPsCtrl]      = 0x00000004U,
+        [kDEMO_PXP_CmdPsBuf]       = TEST_DEST_ADDR,
+        [kDEMO_PXP_CmdPsPitch]     = TEST_DEST_PITCH,
+        [kDEMO_PXP_CmdPsScale]     = 0x10001000U,
+        [kDEMO_PXP_CmdPsClrKeyLow] = 0x00FFFFFFU,
+        [kDEMO_PXP_CmdAsCtrl]      = 0x00000000U,
+        [kDEMO_PXP_CmdAsBuf]       = TEST_SRC_ADDR,
+        [kDEMO_PXP_CmdAsPitch]     = TEST_SRC_PITCH,
+        [kDEMO_PXP_CmdAsClrKeyLow] = 0x00FFFFFFU,
+    };
+
+    (void)memset(&s_cmd, 0x5A, sizeof(s_cmd));
+    DEMO_PXP_CmdInitBlend(&s_cmd, kPXP_OutputPixelFormatARGB8888, kPXP_PsPixelFormatARGB8888,
+                          kPXP_AsPixelFormatARGB8888);
+    DEMO_PXP_CmdSetBlend(&s_cmd, TEST_DEST_ADDR, TEST_DEST_PITCH, TEST_SRC_ADDR, TEST_SRC_PITCH, TEST_WIDTH,
+                         TEST_HEIGHT);
+    TEST_CheckCmd(expect, &s_cmd);
+}
+
+static void TEST_ScaleImage(void)
+{
+    const pxp_ps_scaler_config_t scaler = {.decX = 1U, .decY = 2U, .scaleX = 0x1800U, .scaleY = 0x0800U};
+    uint32_t expect[DEMO_PXP_CMD_WORDS] = {
+        [kDEMO_PXP_CmdCtrl]        = 0x04010003U,
+        [kDEMO_PXP_CmdOutCtrl]     = 0x0000000EU,
+        [kDEMO_PXP_CmdOutBuf]      = TEST_DEST_ADDR,
+        [kDEMO_PXP_CmdOutPitch]    = TEST_DEST_PITCH,
+        [kDEMO_PXP_CmdOutLrc]      = 0x0017000FU,
+        [kDEMO_PXP_CmdOutPsLrc]    = 0x0017000FU,
+        [kDEMO_PXP_CmdOutAsUlc]    = 0x3FFF3FFFU,
+        [kDEMO_PXP_CmdPsCtrl]      = 0x0000060EU,
+        [kDEMO_PXP_CmdPsBuf]       = TEST_SRC_ADDR,
+        [kDEMO_PXP_CmdPsPitch]     = TEST_SRC_PITCH,
+        [kDEMO_PXP_CmdPsScale]     = 0x08001800U,
+        [kDEMO_PXP_CmdPsOffset]    = 0x00200010U,
+        [kDEMO_PXP_CmdPsClrKeyLow] = 0x00FFFFFFU,
+        [kDEMO_PXP_CmdAsCtrl]      = 0x000300E6U,
+        [kDEMO_PXP_CmdAsClrKeyLow] = 0x00FFFFFFU,
+    };
+
+    (void)memset(&s_cmd, 0x5A, sizeof(s_cmd));
+    DEMO_PXP_CmdInitScale(&s_cmd, kPXP_OutputPixelFormatRGB565, kPXP_PsPixelFormatRGB565);
+    DEMO_PXP_CmdSetScale(&s_cmd, TEST_DEST_ADDR, TEST_DEST_PITCH, TEST_SRC_ADDR, TEST_SRC_PITCH, TEST_WIDTH,
+                         TEST_HEIGHT, &scaler, 0x10U, 0x20U);
+    TEST_CheckCmd(expect, &s_cmd);
+}
+
+/* The rotation command gives the same output as the CPU rotation. */
+static void TEST_RectRun(pxp_rotate_degree_t degree)
+{
+    bool swap               = (kPXP_Rotate90 == degree) || (kPXP_Rotate270 == degree);
+    demo_rotate_image_t src = {
+        .buffer       = s_src,
+        .strideBytes  = sizeof(s_src[0]),
+        .width        = TEST_WIDTH,
+        .height       = TEST_HEIGHT,
+        .bytePerPixel = 2U,
+    };
+    demo_rotate_image_t ref = {
+        .buffer       = s_ref,
+        .strideBytes  = sizeof(s_ref[0]),
+        .width        = swap ? TEST_HEIGHT : TEST_WIDTH,
+        .height       = swap ? TEST_WIDTH : TEST_HEIGHT,
+        .bytePerPixel = 2U,
+    };
+
+    TEST_InitBuffer();
+
+    DEMO_PXP_CmdInitRect(&s_cmd, kPXP_AsPixelFormatRGB565, degree);
+    DEMO_PXP_CmdSetRect(&s_cmd, PXP_MODEL_Addr(s_dest), sizeof(s_dest[0]), PXP_MODEL_Addr(s_src), sizeof(s_src[0]),
+                        TEST_WIDTH, TEST_HEIGHT);
+    TEST_RunCmd(&s_cmd);
+
+    DEMO_Rotate(&ref, &src, (demo_rotate_degree_t)degree);
+
+    TEST_CHECK(0 == memcmp(s_ref, s_dest, sizeof(s_ref)));
+}
+
+/* The blend command reads the destination as PS, the blending is set by Porter-Duff. */
+static void TEST_BlendRun(void)
+{
+    pxp_porter_duff_config_t pdConfig;
+    uint32_t x, y;
+
+    TEST_InitBuffer();
+
+    for (y = 0U; y < TEST_HEIGHT; y++)
+    {
+        for (x = 0U; x < TEST_WIDTH; x++)
+        {
+            /* Half of the AS is transparent, the other half is opaque. */
+            s_dest8888[y][x] = ((x < (TEST_WIDTH / 2U)) ? 0x00000000U : 0xFF000000U) | 0x00123456U;
+        }
+    }
+
+    TEST_CHECK(kStatus_Success == PXP_GetPorterDuffConfig(kPXP_PorterDuffOver, &pdConfig));
+    PXP_SetPorterDuffConfig(PXP, &pdConfig);
+
+    /* Blend s_dest8888 onto s_src8888. */
+    DEMO_PXP_CmdInitBlend(&s_cmd, kPXP_OutputPixelFormatARGB8888, kPXP_PsPixelFormatARGB8888,
+                          kPXP_AsPixelFormatARGB8888);
+    DEMO_PXP_CmdSetBlend(&s_cmd, PXP_MODEL_Addr(s_src8888), sizeof(s_src8888[0]), PXP_MODEL_Addr(s_dest8888),
+                         sizeof(s_dest8888[0]), TEST_WIDTH, TEST_HEIGHT);
+    TEST_RunCmd(&s_cmd);
+
+    for (y = 0U; y < TEST_HEIGHT; y++)
+    {
+        for (x = 0U; x < TEST_WIDTH; x++)
+        {
+            TEST_CHECK_EQUAL((x < (TEST_WIDTH / 2U)) ? (0xFF000000U | (y << 18U) | (x << 10U) | (x ^ y)) : 0xFF123456U,
+                             s_src8888[y][x]);
+        }
+    }
+
+    (void)memset(&pdConfig, 0, sizeof(pdConfig));
+    PXP_SetPorterDuffConfig(PXP, &pdConfig);
+}
+
+/* Down scale by 2, every output pixel is the average of a 2x2 block with the same color. */
+static void TEST_ScaleRun(void)
+{
+    pxp_ps_scaler_config_t scaler;
+    uint32_t x, y;
+
+    TEST_InitBuffer();
+
+    for (y = 0U; y < TEST_HEIGHT; y++)
+    {
+        for (x = 0U; x < TEST_WIDTH; x++)
+        {
+            s_src[y][x] = (uint16_t)(((y / 2U) << 11U) | ((x / 2U) << 5U));
+        }
+    }
+
+    PXP_GetProcessSurfaceScalerConfig(TEST_WIDTH, TEST_HEIGHT, TEST_WIDTH / 2U, TEST_HEIGHT / 2U, &scaler);
+
+    DEMO_PXP_CmdInitScale(&s_cmd, kPXP_OutputPixelFormatRGB565, kPXP_PsPixelFormatRGB565);
+    DEMO_PXP_CmdSetScale(&s_cmd, PXP_MODEL_Addr(s_dest), sizeof(s_dest[0]), PXP_MODEL_Addr(s_src), sizeof(s_src[0]),
+                         TEST_WIDTH / 2U, TEST_HEIGHT / 2U, &scaler, 0U, 0U);
+    TEST_RunCmd(&s_cmd);
+
+    for (y = 0U; y < TEST_WIDTH; y++)
+    {
+        for (x = 0U; x < TEST_WIDTH; x++)
+        {
+            TEST_CHECK_EQUAL(((x < (TEST_WIDTH / 2U)) && (y < (TEST_HEIGHT / 2U))) ? ((y << 11U) | (x << 5U)) : 0xA5A5U,
+                             s_dest[y][x]);
+        }
+    }
+}
+
+int main(void)
+{
+    PXP_MODEL_Reset();
+    PXP_Init(PXP);
+
+    TEST_RUN(TEST_RectImage());
+    TEST_RUN(TEST_BlendImage());
+    TEST_RUN(TEST_ScaleImage());
+    TEST_RUN(TEST_RectRun(kPXP_Rotate0));
+    TEST_RUN(TEST_RectRun(kPXP_Rotate90));
+    TEST_RUN(TEST_RectRun(kPXP_Rotate180));
+    TEST_RUN(TEST_RectRun(kPXP_Rotate270));
+    TEST_RUN(TEST_BlendRun());
+    TEST_RUN(TEST_ScaleRun());
+
+    PXP_Deinit(PXP);
+
+    return TEST_RESULT();
+}
@@ -0,0 +1,163 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "pxp_support.h"
+#include "test_pxp.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Bigger than the chunk size set for this test, and than PXP_MemCopy in one operation. */
+#define TEST_BUF_BYTES (64U * 1024U)
+
+/* Room around the copy, it must not be written. */
+#define TEST_GUARD_BYTES 64U
+
+#define TEST_GUARD_VALUE 0xA5U
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static SDK_ALIGN(uint8_t s_src[TEST_BUF_BYTES + 2U * TEST_GUARD_BYTES], 64);
+static SDK_ALIGN(uint8_t s_dest[TEST_BUF_BYTES + 2U * TEST_GUARD_BYTES], 64);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void TEST_InitBuffer(void)
+{
+    uint32_t i;
+
+    for (i = 0U; i < sizeof(s_src); i++)
+    {
+        s_src[i] = (uint8_t)((i * 7U) ^ (i >> 8U));
+    }
+
+    (void)memset(s_dest, TEST_GUARD_VALUE, sizeof(s_dest));
+}
+
+/* Only [destOffset, destOffset + size) of the destination is the source copy. */
+static void TEST_CheckCopy(uint32_t destOffset, uint32_t srcOffset, uint32_t size)
+{
+    uint32_t i;
+    uint32_t errors = 0U;
+
+    for (i = 0U; i < sizeof(s_dest); i++)
+    {
+        if ((i >= destOffset) && (i < (destOffset + size)))
+        {
+            errors += (s_dest[i] != s_src[i - destOffset + srcOffset]) ? 1U : 0U;
+        }
+        else
+        {
+            errors += (s_dest[i] != TEST_GUARD_VALUE) ? 1U : 0U;
+        }
+    }
+
+    TEST_CHECK_EQUAL(0U, errors);
+}
+
+static uint32_t TEST_GetOperations(void)
+{
+    pxp_model_stat_t stat;
+
+    PXP_MODEL_GetStat(&stat);
+
+    return stat.operations;
+}
+
+static void TEST_DriverMemCopy(void)
+{
+    const uint32_t sizes[] = {512U, 1024U + 100U, 8U * 512U, 40U * 1024U + 4U};
+    uint32_t i;
+
+    PXP_Init(PXP);
+
+    for (i = 0U; i < ARRAY_SIZE(sizes); i++)
+    {
+        TEST_InitBuffer();
+
+        TEST_CHECK(kStatus_Success == PXP_MemCopy(PXP, PXP_MODEL_Addr(&s_src[TEST_GUARD_BYTES]),
+                                                  PXP_MODEL_Addr(&s_dest[TEST_GUARD_BYTES]), sizes[i]));
+
+        TEST_CheckCopy(TEST_GUARD_BYTES, TEST_GUARD_BYTES, sizes[i]);
+    }
+
+    TEST_InitBuffer();
+    TEST_CHECK(kStatus_InvalidArgument == PXP_StartMemCopy(PXP, PXP_MODEL_Addr(&s_src[TEST_GUARD_BYTES]),
+                                                           PXP_MODEL_Addr(&s_dest[TEST_GUARD_BYTES]), 1000U));
+    TEST_CHECK(kStatus_Success == PXP_StartMemCopy(PXP, PXP_MODEL_Addr(&s_src[TEST_GUARD_BYTES]),
+                                                   PXP_MODEL_Addr(&s_dest[TEST_GUARD_BYTES]), 2048U));
+    while (0U == (PXP_GetStatusFlags(PXP) & (uint32_t)kPXP_CompleteFlag))
+    {
+    }
+    PXP_ClearStatusFlags(PXP, (uint32_t)kPXP_CompleteFlag);
+    TEST_CheckCopy(TEST_GUARD_BYTES, TEST_GUARD_BYTES, 2048U);
+
+    PXP_Deinit(PXP);
+}
+
+/*
+ * The head until the cache line and the tail after the last 512 bytes are
+ * copied by CPU, the body by PXP in chunks.
+ */
+static void TEST_DemoMemCopy(void)
+{
+    demo_pxp_memcopy_t handle;
+    uint32_t destOffset = TEST_GUARD_BYTES + 4U;
+    uint32_t srcOffset  = TEST_GUARD_BYTES + 8U;
+    uint32_t size       = TEST_BUF_BYTES - 8U;
+    uint32_t headSize   = FSL_FEATURE_L1DCACHE_LINESIZE_BYTE - 4U;
+    uint32_t bodySize   = ((size - headSize) / 512U) * 512U;
+    uint32_t operations;
+
+    TEST_CHECK(kStatus_Success == DEMO_PXP_Init());
+    (void)PXP_MODEL_SetIRQHandler(DEMO_PXP_IRQHandler);
+    TEST_CHECK(kStatus_Success == DEMO_PXP_InitMemCopy(&handle));
+    DEMO_PXP_SetMemCopyThreshold(1024U);
+
+    /* Split into chunks. */
+    TEST_InitBuffer();
+    operations = TEST_GetOperations();
+    DEMO_PXP_StartMemCopy(&handle, &s_dest[destOffset], &s_src[srcOffset], size);
+    DEMO_PXP_WaitMemCopy(&handle);
+    TEST_CHECK(DEMO_PXP_IsMemCopyDone(&handle));
+    TEST_CheckCopy(destOffset, srcOffset, size);
+    TEST_CHECK_EQUAL((bodySize + DEMO_PXP_MEMCOPY_CHUNK_BYTES - 1U) / DEMO_PXP_MEMCOPY_CHUNK_BYTES,
+                     TEST_GetOperations() - operations);
+
+    /* Below the threshold, CPU only. */
+    TEST_InitBuffer();
+    operations = TEST_GetOperations();
+    DEMO_PXP_StartMemCopy(&handle, &s_dest[destOffset], &s_src[srcOffset], 1000U);
+    DEMO_PXP_WaitMemCopy(&handle);
+    TEST_CheckCopy(destOffset, srcOffset, 1000U);
+    TEST_CHECK_EQUAL(0U, TEST_GetOperations() - operations);
+
+    /* The buffers could not be 4-byte aligned together, CPU only. */
+    TEST_InitBuffer();
+    operations = TEST_GetOperations();
+    DEMO_PXP_StartMemCopy(&handle, &s_dest[destOffset], &s_src[srcOffset + 1U], size - 1U);
+    DEMO_PXP_WaitMemCopy(&handle);
+    TEST_CheckCopy(destOffset, srcOffset + 1U, size - 1U);
+    TEST_CHECK_EQUAL(0U, TEST_GetOperations() - operations);
+
+    (void)PXP_MODEL_SetIRQHandler(NULL);
+}
+
+int main(void)
+{
+    PXP_MODEL_Reset();
+
+    TEST_RUN(TEST_DriverMemCopy());
+    TEST_RUN(TEST_DemoMemCopy());
+
+    return TEST_RESULT();
+}
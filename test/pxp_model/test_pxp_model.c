@@ -0,0 +1,346 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_pxp.h"
+#include "rotate_support.h"
+#include "test_pxp.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define TEST_SRC_WIDTH   24U
+#define TEST_SRC_HEIGHT  16U
+#define TEST_DEST_WIDTH  32U
+#define TEST_DEST_HEIGHT 32U
+
+/* Value of the output pixels not written by the PXP. */
+#define TEST_GUARD_PIXEL 0xA5A5A5A5U
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static uint16_t s_src565[TEST_SRC_HEIGHT][TEST_SRC_WIDTH];
+static uint16_t s_dest565[TEST_DEST_HEIGHT][TEST_DEST_WIDTH];
+static uint16_t s_ref565[TEST_DEST_HEIGHT][TEST_DEST_WIDTH];
+static uint32_t s_src8888[TEST_SRC_HEIGHT][TEST_SRC_WIDTH];
+static uint32_t s_dest8888[TEST_DEST_HEIGHT][TEST_DEST_WIDTH];
+static SDK_ALIGN(uint32_t s_cmd[32], 4);
+
+static volatile uint32_t s_completeCount;
+static volatile uint32_t s_loadCount;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void TEST_IRQHandler(void)
+{
+    uint32_t flags = PXP_GetStatusFlags(PXP);
+
+    PXP_ClearStatusFlags(PXP, flags);
+
+    if (0U != (flags & (uint32_t)kPXP_CompleteFlag))
+    {
+        s_completeCount++;
+    }
+
+    if (0U != (flags & (uint32_t)kPXP_CommandLoadFlag))
+    {
+        s_loadCount++;
+    }
+}
+
+static void TEST_WaitComplete(void)
+{
+    while (0U == (PXP_GetStatusFlags(PXP) & (uint32_t)kPXP_CompleteFlag))
+    {
+    }
+
+    PXP_ClearStatusFlags(PXP, (uint32_t)kPXP_CompleteFlag);
+}
+
+static void TEST_InitSource(void)
+{
+    uint32_t x, y;
+
+    for (y = 0U; y < TEST_SRC_HEIGHT; y++)
+    {
+        for (x = 0U; x < TEST_SRC_WIDTH; x++)
+        {
+            s_src565[y][x]  = (uint16_t)((y << 11U) | (x << 5U) | ((x + y) & 0x1FU));
+            s_src8888[y][x] = 0xFF000000U | (y << 16U) | (x << 8U) | (x ^ y);
+        }
+    }
+
+    (void)memset(s_dest565, 0xA5, sizeof(s_dest565));
+    (void)memset(s_dest8888, 0xA5, sizeof(s_dest8888));
+}
+
+static void TEST_PictureCopy(void)
+{
+    pxp_pic_copy_config_t config = {
+        .srcPicBaseAddr  = PXP_MODEL_Addr(s_src565),
+        .srcPitchBytes   = sizeof(s_src565[0]),
+        .srcOffsetX      = 3U,
+        .srcOffsetY      = 2U,
+        .destPicBaseAddr = PXP_MODEL_Addr(s_dest565),
+        .destPitchBytes  = sizeof(s_dest565[0]),
+        .destOffsetX     = 5U,
+        .destOffsetY     = 4U,
+        .width           = 10U,
+        .height          = 7U,
+        .pixelFormat     = kPXP_AsPixelFormatRGB565,
+    };
+    uint32_t x, y;
+    bool inside;
+
+    TEST_InitSource();
+
+    TEST_CHECK(kStatus_Success == PXP_StartPictureCopy(PXP, &config));
+    TEST_WaitComplete();
+
+    for (y = 0U; y < TEST_DEST_HEIGHT; y++)
+    {
+        for (x = 0U; x < TEST_DEST_WIDTH; x++)
+        {
+            inside = (x >= 5U) && (x < 15U) && (y >= 4U) && (y < 11U);
+
+            TEST_CHECK_EQUAL(inside ? s_src565[y - 4U + 2U][x - 5U + 3U] : (uint16_t)TEST_GUARD_PIXEL,
+                             s_dest565[y][x]);
+        }
+    }
+}
+
+/* The PXP rotation is compared with the CPU one. */
+static void TEST_Rotate(pxp_rotate_degree_t degree)
+{
+    bool swap                        = (kPXP_Rotate90 == degree) || (kPXP_Rotate270 == degree);
+    pxp_ps_buffer_config_t psConfig  = {
+        .pixelFormat = kPXP_PsPixelFormatRGB565,
+        .swapByte    = false,
+        .bufferAddr  = PXP_MODEL_Addr(s_src565),
+        .pitchBytes  = sizeof(s_src565[0]),
+    };
+    pxp_output_buffer_config_t outConfig = {
+        .pixelFormat    = kPXP_OutputPixelFormatRGB565,
+        .interlacedMode = kPXP_OutputProgressive,
+        .buffer0Addr    = PXP_MODEL_Addr(s_dest565),
+        .pitchBytes     = sizeof(s_dest565[0]),
+        .width          = TEST_SRC_WIDTH,
+        .height         = TEST_SRC_HEIGHT,
+    };
+    demo_rotate_image_t src = {
+        .buffer       = s_src565,
+        .strideBytes  = sizeof(s_src565[0]),
+        .width        = TEST_SRC_WIDTH,
+        .height       = TEST_SRC_HEIGHT,
+        .bytePerPixel = 2U,
+    };
+    demo_rotate_image_t ref = {
+        .buffer       = s_ref565,
+        .strideBytes  = sizeof(s_ref565[0]),
+        .width        = swap ? TEST_SRC_HEIGHT : TEST_SRC_WIDTH,
+        .height       = swap ? TEST_SRC_WIDTH : TEST_SRC_HEIGHT,
+        .bytePerPixel = 2U,
+    };
+
+    TEST_InitSource();
+    (void)memset(s_ref565, 0xA5, sizeof(s_ref565));
+
+    PXP_Init(PXP);
+    PXP_SetProcessSurfaceBufferConfig(PXP, &psConfig);
+    PXP_SetProcessSurfacePosition(PXP, 0U, 0U, TEST_SRC_WIDTH - 1U, TEST_SRC_HEIGHT - 1U);
+    PXP_SetAlphaSurfacePosition(PXP, 0xFFFFU, 0xFFFFU, 0U, 0U);
+    PXP_SetOutputBufferConfig(PXP, &outConfig);
+    PXP_SetRotateConfig(PXP, kPXP_RotateOutputBuffer, degree, kPXP_FlipDisable);
+    PXP_Start(PXP);
+    TEST_WaitComplete();
+
+    DEMO_Rotate(&ref, &src, (demo_rotate_degree_t)degree);
+
+    TEST_CHECK(0 == memcmp(s_ref565, s_dest565, sizeof(s_ref565)));
+
+    PXP_Deinit(PXP);
+}
+
+/* Only the PS background is used, the alpha is the one of the fill color. */
+static void TEST_Fill(void)
+{
+    pxp_fill_config_t config = {
+        .destPicBaseAddr = PXP_MODEL_Addr(s_dest8888),
+        .destPitchBytes  = sizeof(s_dest8888[0]),
+        .destOffsetX     = 2U,
+        .destOffsetY     = 6U,
+        .width           = 20U,
+        .height          = 3U,
+        .color           = 0x80123456U,
+        .pixelFormat     = kPXP_OutputPixelFormatARGB8888,
+    };
+    uint32_t x, y;
+    bool inside;
+
+    TEST_InitSource();
+
+    PXP_Init(PXP);
+    TEST_CHECK(kStatus_Success == PXP_StartFill(PXP, &config));
+    TEST_WaitComplete();
+
+    for (y = 0U; y < TEST_DEST_HEIGHT; y++)
+    {
+        for (x = 0U; x < TEST_DEST_WIDTH; x++)
+        {
+            inside = (x >= 2U) && (x < 22U) && (y >= 6U) && (y < 9U);
+
+            TEST_CHECK_EQUAL(inside ? 0x80123456U : TEST_GUARD_PIXEL, s_dest8888[y][x]);
+        }
+    }
+
+    PXP_Deinit(PXP);
+}
+
+/* Source over: out = src * srcAlpha + dest * (1 - srcAlpha). */
+static void TEST_PorterDuffOver(void)
+{
+    pxp_ps_buffer_config_t psConfig = {
+        .pixelFormat = kPXP_PsPixelFormatARGB8888,
+        .swapByte    = false,
+        .bufferAddr  = PXP_MODEL_Addr(s_src8888),
+        .pitchBytes  = sizeof(s_src8888[0]),
+    };
+    pxp_as_buffer_config_t asConfig = {
+        .pixelFormat = kPXP_AsPixelFormatARGB8888,
+        .bufferAddr  = PXP_MODEL_Addr(s_dest8888),
+        .pitchBytes  = sizeof(s_dest8888[0]),
+    };
+    pxp_output_buffer_config_t outConfig = {
+        .pixelFormat    = kPXP_OutputPixelFormatARGB8888,
+        .interlacedMode = kPXP_OutputProgressive,
+        .buffer0Addr    = PXP_MODEL_Addr(s_dest8888),
+        .pitchBytes     = sizeof(s_dest8888[0]),
+        .width          = TEST_SRC_WIDTH,
+        .height         = TEST_SRC_HEIGHT,
+    };
+    pxp_porter_duff_config_t pdConfig;
+    uint32_t dest, src, out, expect;
+    uint32_t shift;
+    uint32_t x, y;
+
+    TEST_InitSource();
+
+    for (y = 0U; y < TEST_SRC_HEIGHT; y++)
+    {
+        for (x = 0U; x < TEST_SRC_WIDTH; x++)
+        {
+            s_dest8888[y][x] = 0x80FF0000U | (x << 3U);
+        }
+    }
+
+    PXP_Init(PXP);
+    PXP_SetProcessSurfaceBufferConfig(PXP, &psConfig);
+    PXP_SetProcessSurfacePosition(PXP, 0U, 0U, TEST_SRC_WIDTH - 1U, TEST_SRC_HEIGHT - 1U);
+    PXP_SetAlphaSurfaceBufferConfig(PXP, &asConfig);
+    PXP_SetAlphaSurfacePosition(PXP, 0U, 0U, TEST_SRC_WIDTH - 1U, TEST_SRC_HEIGHT - 1U);
+    PXP_SetOutputBufferConfig(PXP, &outConfig);
+    TEST_CHECK(kStatus_Success == PXP_GetPorterDuffConfig(kPXP_PorterDuffOver, &pdConfig));
+    PXP_SetPorterDuffConfig(PXP, &pdConfig);
+    PXP_Start(PXP);
+    TEST_WaitComplete();
+
+    for (y = 0U; y < TEST_SRC_HEIGHT; y++)
+    {
+        for (x = 0U; x < TEST_SRC_WIDTH; x++)
+        {
+            src  = 0x80FF0000U | (x << 3U);
+            dest = s_src8888[y][x];
+            out  = s_dest8888[y][x];
+
+            /* The source is premultiplied with its alpha 0x80, the dest alpha is 0xFF. */
+            expect = 0xFF000000U;
+            for (shift = 0U; shift < 24U; shift += 8U)
+            {
+                expect |= ((((src >> shift) & 0xFFU) * 0x80U / 0xFFU +
+                            ((dest >> shift) & 0xFFU) * (0xFFU - 0x80U) / 0xFFU) & 0xFFU)
+                          << shift;
+            }
+
+            TEST_CHECK_EQUAL(expect, out);
+        }
+    }
+
+    PXP_Deinit(PXP);
+}
+
+/* The command fills the output with the PS background, then the completion interrupt comes. */
+static void TEST_NextCommand(void)
+{
+    uint32_t x, y;
+    uint32_t i;
+
+    TEST_InitSource();
+    s_completeCount = 0U;
+    s_loadCount     = 0U;
+
+    (void)memset(s_cmd, 0, sizeof(s_cmd));
+    s_cmd[0]  = PXP_CTRL_ENABLE_MASK | PXP_CTRL_IRQ_ENABLE_MASK | PXP_CTRL_NEXT_IRQ_ENABLE_MASK |
+               PXP_CTRL_ENABLE_PS_AS_OUT_MASK | PXP_CTRL_ENABLE_ROTATE0_MASK;
+    s_cmd[1]  = PXP_OUT_CTRL_FORMAT(kPXP_OutputPixelFormatRGB565);
+    s_cmd[2]  = PXP_MODEL_Addr(s_dest565);
+    s_cmd[4]  = sizeof(s_dest565[0]);
+    s_cmd[5]  = PXP_OUT_LRC_X(TEST_SRC_WIDTH - 1U) | PXP_OUT_LRC_Y(TEST_SRC_HEIGHT - 1U);
+    s_cmd[6]  = PXP_OUT_PS_ULC_X(0x3FFFU) | PXP_OUT_PS_ULC_Y(0x3FFFU);
+    s_cmd[8]  = PXP_OUT_AS_ULC_X(0x3FFFU) | PXP_OUT_AS_ULC_Y(0x3FFFU);
+    s_cmd[15] = 0x00FF00FFU;
+    s_cmd[16] = 0x10001000U;
+
+    PXP_Init(PXP);
+    (void)PXP_MODEL_SetIRQHandler(TEST_IRQHandler);
+    (void)EnableIRQ(PXP_IRQn);
+
+    PXP_SetNextCommand(PXP, s_cmd);
+
+    /* The model runs the PXP on register access. */
+    for (i = 0U; (0U == s_completeCount) && (i < 100U); i++)
+    {
+        (void)PXP_IsNextCommandPending(PXP);
+    }
+
+    TEST_CHECK_EQUAL(1U, s_loadCount);
+    TEST_CHECK_EQUAL(1U, s_completeCount);
+    TEST_CHECK(!PXP_IsNextCommandPending(PXP));
+
+    for (y = 0U; y < TEST_DEST_HEIGHT; y++)
+    {
+        for (x = 0U; x < TEST_DEST_WIDTH; x++)
+        {
+            TEST_CHECK_EQUAL(((x < TEST_SRC_WIDTH) && (y < TEST_SRC_HEIGHT)) ? 0xF81FU : (uint16_t)TEST_GUARD_PIXEL,
+                             s_dest565[y][x]);
+        }
+    }
+
+    (void)DisableIRQ(PXP_IRQn);
+    (void)PXP_MODEL_SetIRQHandler(NULL);
+    PXP_Deinit(PXP);
+}
+
+int main(void)
+{
+    PXP_MODEL_Reset();
+    PXP_Init(PXP);
+
+    TEST_RUN(TEST_PictureCopy());
+    TEST_RUN(TEST_Rotate(kPXP_Rotate0));
+    TEST_RUN(TEST_Rotate(kPXP_Rotate90));
+    TEST_RUN(TEST_Rotate(kPXP_Rotate180));
+    TEST_RUN(TEST_Rotate(kPXP_Rotate270));
+    TEST_RUN(TEST_Fill());
+    TEST_RUN(TEST_PorterDuffOver());
+    TEST_RUN(TEST_NextCommand());
+
+    return TEST_RESULT();
+}
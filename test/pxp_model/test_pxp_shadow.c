@@ -0,0 +1,187 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_pxp.h"
+#include "test_pxp.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define TEST_WIDTH  32U
+#define TEST_HEIGHT 16U
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static uint16_t s_src[TEST_HEIGHT][TEST_WIDTH];
+static uint16_t s_dest[TEST_HEIGHT][TEST_WIDTH];
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void TEST_WaitComplete(void)
+{
+    while (0U == (PXP_GetStatusFlags(PXP) & (uint32_t)kPXP_CompleteFlag))
+    {
+    }
+
+    PXP_ClearStatusFlags(PXP, (uint32_t)kPXP_CompleteFlag);
+}
+
+static void TEST_InitBuffer(void)
+{
+    uint32_t x, y;
+
+    for (y = 0U; y < TEST_HEIGHT; y++)
+    {
+        for (x = 0U; x < TEST_WIDTH; x++)
+        {
+            s_src[y][x] = (uint16_t)((y << 11U) | (x << 5U) | (x ^ y));
+        }
+    }
+
+    (void)memset(s_dest, 0xA5, sizeof(s_dest));
+}
+
+static void TEST_Copy(uint16_t destX, uint16_t destY)
+{
+    pxp_pic_copy_config_t config = {
+        .srcPicBaseAddr  = PXP_MODEL_Addr(s_src),
+        .srcPitchBytes   = sizeof(s_src[0]),
+        .srcOffsetX      = 0U,
+        .srcOffsetY      = 0U,
+        .destPicBaseAddr = PXP_MODEL_Addr(s_dest),
+        .destPitchBytes  = sizeof(s_dest[0]),
+        .destOffsetX     = destX,
+        .destOffsetY     = destY,
+        .width           = 8U,
+        .height          = 4U,
+        .pixelFormat     = kPXP_AsPixelFormatRGB565,
+    };
+
+    TEST_CHECK(kStatus_Success == PXP_StartPictureCopy(PXP, &config));
+    TEST_WaitComplete();
+}
+
+static void TEST_CheckCopy(uint16_t destX, uint16_t destY)
+{
+    uint32_t x, y;
+
+    for (y = 0U; y < 4U; y++)
+    {
+        for (x = 0U; x < 8U; x++)
+        {
+            TEST_CHECK_EQUAL(s_src[y][x], s_dest[destY + y][destX + x]);
+        }
+    }
+}
+
+/* The same operation again writes no configuration register. */
+static void TEST_RepeatSkipped(void)
+{
+    pxp_shadow_stat_t first;
+    pxp_shadow_stat_t stat;
+
+    TEST_InitBuffer();
+    PXP_Init(PXP);
+    PXP_ClearShadowStat(PXP);
+
+    TEST_Copy(4U, 2U);
+    PXP_GetShadowStat(PXP, &first);
+    TEST_CHECK(0U != first.written);
+
+    PXP_ClearShadowStat(PXP);
+    PXP_GetShadowStat(PXP, &stat);
+    TEST_CHECK_EQUAL(0U, stat.written);
+    TEST_CHECK_EQUAL(0U, stat.skipped);
+
+    (void)memset(s_dest, 0xA5, sizeof(s_dest));
+    TEST_Copy(4U, 2U);
+    PXP_GetShadowStat(PXP, &stat);
+    TEST_CHECK_EQUAL(0U, stat.written);
+    TEST_CHECK_EQUAL(first.written + first.skipped, stat.skipped);
+    TEST_CheckCopy(4U, 2U);
+
+    PXP_ClearShadowStat(PXP);
+    TEST_Copy(4U, 8U);
+    PXP_GetShadowStat(PXP, &stat);
+    TEST_CHECK_EQUAL(1U, stat.written); /* OUT_BUF. */
+    TEST_CHECK_EQUAL(first.written + first.skipped - 1U, stat.skipped);
+    TEST_CheckCopy(4U, 8U);
+
+    /* Only the read-modify-write registers are still skipped. */
+    PXP_InvalidateShadow(PXP);
+    PXP_ClearShadowStat(PXP);
+    TEST_Copy(4U, 8U);
+    PXP_GetShadowStat(PXP, &stat);
+    TEST_CHECK(stat.written > 1U);
+    TEST_CHECK_EQUAL(first.written + first.skipped, stat.written + stat.skipped);
+
+    PXP_Deinit(PXP);
+}
+
+/*
+ * The fill leaves its PS background and AS color key in the registers, the
+ * copy after it must not be changed by them.
+ */
+static void TEST_FillThenCopy(void)
+{
+    pxp_fill_config_t fillConfig = {
+        .destPicBaseAddr = PXP_MODEL_Addr(s_dest),
+        .destPitchBytes  = sizeof(s_dest[0]),
+        .destOffsetX     = 0U,
+        .destOffsetY     = 0U,
+        .width           = TEST_WIDTH,
+        .height          = TEST_HEIGHT,
+        .color           = 0xFF00FF00U,
+        .pixelFormat     = kPXP_OutputPixelFormatRGB565,
+    };
+    pxp_model_stat_t modelStat;
+    uint32_t round;
+    uint32_t x, y;
+
+    TEST_InitBuffer();
+    PXP_Init(PXP);
+
+    for (round = 0U; round < 2U; round++)
+    {
+        TEST_CHECK(kStatus_Success == PXP_StartFill(PXP, &fillConfig));
+        TEST_WaitComplete();
+
+        for (y = 0U; y < TEST_HEIGHT; y++)
+        {
+            for (x = 0U; x < TEST_WIDTH; x++)
+            {
+                TEST_CHECK_EQUAL(0x07E0U, s_dest[y][x]);
+            }
+        }
+
+        TEST_Copy(8U, 4U);
+        TEST_CheckCopy(8U, 4U);
+        TEST_CHECK_EQUAL(0x07E0U, s_dest[3][8]);
+        TEST_CHECK_EQUAL(0x07E0U, s_dest[4][16]);
+    }
+
+    /* The engines are kept enabled, no operation is dropped. */
+    PXP_MODEL_GetStat(&modelStat);
+    TEST_CHECK_EQUAL(0U, modelStat.dropped);
+
+    PXP_Deinit(PXP);
+}
+
+int main(void)
+{
+    PXP_MODEL_Reset();
+
+    TEST_RUN(TEST_RepeatSkipped());
+    TEST_RUN(TEST_FillThenCopy());
+
+    return TEST_RESULT();
+}
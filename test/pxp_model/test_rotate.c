@@ -0,0 +1,187 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <string.h>
+
+#include "rotate_support.h"
+#include "test_pxp.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Not multiple of the tile size, and the stride is padded. */
+#define TEST_WIDTH        75U
+#define TEST_HEIGHT       43U
+#define TEST_PAD_BYTES    12U
+#define TEST_MAX_BPP      4U
+#define TEST_BUFFER_BYTES ((TEST_WIDTH * TEST_MAX_BPP + TEST_PAD_BYTES) * TEST_WIDTH)
+
+/* Never written by the rotation. */
+#define TEST_UNTOUCHED 0xA5U
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static uint8_t s_src[TEST_BUFFER_BYTES];
+static uint8_t s_dest[TEST_BUFFER_BYTES];
+
+static const demo_rotate_rect_t s_rects[] = {
+    {0U, 0U, TEST_WIDTH, TEST_HEIGHT},
+    {0U, 0U, 1U, 1U},
+    {TEST_WIDTH - 1U, TEST_HEIGHT - 1U, 1U, 1U},
+    {1U, 2U, 33U, 17U},
+    {7U, 0U, 1U, TEST_HEIGHT},
+    {0U, 5U, TEST_WIDTH, 1U},
+    {40U, 20U, TEST_WIDTH - 40U, TEST_HEIGHT - 20U},
+    {3U, 9U, 64U, 32U},
+};
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/* Destination position of source pixel (x, y), rotated clockwise. */
+static void TEST_MapPixel(
+    uint32_t x, uint32_t y, uint32_t width, uint32_t height, demo_rotate_degree_t degree, uint32_t *destX, uint32_t *destY)
+{
+    switch (degree)
+    {
+        case kDEMO_Rotate90:
+            *destX = height - 1U - y;
+            *destY = x;
+            break;
+
+        case kDEMO_Rotate180:
+            *destX = width - 1U - x;
+            *destY = height - 1U - y;
+            break;
+
+        case kDEMO_Rotate270:
+            *destX = y;
+            *destY = width - 1U - x;
+            break;
+
+        default:
+            *destX = x;
+            *destY = y;
+            break;
+    }
+}
+
+static void TEST_InitImages(demo_rotate_image_t *dest, demo_rotate_image_t *src, uint8_t bytePerPixel, demo_rotate_degree_t degree)
+{
+    bool swap = (kDEMO_Rotate90 == degree) || (kDEMO_Rotate270 == degree);
+
+    src->buffer       = s_src;
+    src->width        = TEST_WIDTH;
+    src->height       = TEST_HEIGHT;
+    src->bytePerPixel = bytePerPixel;
+    src->strideBytes  = TEST_WIDTH * bytePerPixel + TEST_PAD_BYTES;
+
+    dest->buffer       = s_dest;
+    dest->width        = swap ? TEST_HEIGHT : TEST_WIDTH;
+    dest->height       = swap ? TEST_WIDTH : TEST_HEIGHT;
+    dest->bytePerPixel = bytePerPixel;
+    dest->strideBytes  = dest->width * bytePerPixel + TEST_PAD_BYTES;
+
+    /* Every source byte is unique in a pixel row, and never the untouched value. */
+    for (uint32_t i = 0U; i < sizeof(s_src); i++)
+    {
+        s_src[i] = (uint8_t)((i * 7U) % 251U);
+    }
+
+    (void)memset(s_dest, TEST_UNTOUCHED, sizeof(s_dest));
+}
+
+/*
+ * Check every destination byte: the pixels inside the rotated rectangle are the
+ * mapped source pixels, all the others including the stride padding are untouched.
+ */
+static bool TEST_CheckImage(const demo_rotate_image_t *dest,
+                            const demo_rotate_image_t *src,
+                            const demo_rotate_rect_t *rect,
+                            demo_rotate_degree_t degree)
+{
+    static uint8_t expect[TEST_BUFFER_BYTES];
+    uint32_t bpp = src->bytePerPixel;
+    uint32_t destX, destY;
+
+    (void)memset(expect, TEST_UNTOUCHED, sizeof(expect));
+
+    for (uint32_t y = rect->y; y < (uint32_t)rect->y + rect->height; y++)
+    {
+        for (uint32_t x = rect->x; x < (uint32_t)rect->x + rect->width; x++)
+        {
+            TEST_MapPixel(x, y, src->width, src->height, degree, &destX, &destY);
+            (void)memcpy(&expect[destY * dest->strideBytes + destX * bpp], &s_src[y * src->strideBytes + x * bpp], bpp);
+        }
+    }
+
+    return 0 == memcmp(expect, s_dest, sizeof(s_dest));
+}
+
+static void TEST_RotateImage(uint8_t bytePerPixel, demo_rotate_degree_t degree)
+{
+    demo_rotate_image_t dest, src;
+
+    TEST_InitImages(&dest, &src, bytePerPixel, degree);
+
+    DEMO_Rotate(&dest, &src, degree);
+
+    TEST_CHECK(TEST_CheckImage(&dest, &src, &s_rects[0], degree));
+}
+
+static void TEST_RotateRect(uint8_t bytePerPixel, demo_rotate_degree_t degree)
+{
+    demo_rotate_image_t dest, src;
+    demo_rotate_rect_t destRect;
+    uint32_t x1, y1, x2, y2;
+
+    for (uint32_t i = 0U; i < ARRAY_SIZE(s_rects); i++)
+    {
+        const demo_rotate_rect_t *rect = &s_rects[i];
+
+        TEST_InitImages(&dest, &src, bytePerPixel, degree);
+
+        DEMO_RotateRect(&dest, &src, rect, degree);
+
+        if (!TEST_CheckImage(&dest, &src, rect, degree))
+        {
+            (void)printf("rect %u,%u %ux%u\n", rect->x, rect->y, rect->width, rect->height);
+            TEST_CHECK(false);
+        }
+
+        /* The rotated rectangle is spanned by the mapped source corners. */
+        DEMO_GetRotatedRect(&src, rect, degree, &destRect);
+        TEST_MapPixel(rect->x, rect->y, src.width, src.height, degree, &x1, &y1);
+        TEST_MapPixel(rect->x + rect->width - 1U, rect->y + rect->height - 1U, src.width, src.height, degree, &x2, &y2);
+        TEST_CHECK_EQUAL(MIN(x1, x2), destRect.x);
+        TEST_CHECK_EQUAL(MIN(y1, y2), destRect.y);
+        TEST_CHECK_EQUAL(MAX(x1, x2) - MIN(x1, x2) + 1U, destRect.width);
+        TEST_CHECK_EQUAL(MAX(y1, y2) - MIN(y1, y2) + 1U, destRect.height);
+    }
+}
+
+int main(void)
+{
+    static const demo_rotate_degree_t degrees[] = {kDEMO_Rotate0, kDEMO_Rotate90, kDEMO_Rotate180, kDEMO_Rotate270};
+    static const uint8_t formats[] = {2U, 4U};
+
+    for (uint32_t f = 0U; f < ARRAY_SIZE(formats); f++)
+    {
+        for (uint32_t d = 0U; d < ARRAY_SIZE(degrees); d++)
+        {
+            (void)printf("%u bytes per pixel, %u degree\n", formats[f], (unsigned int)degrees[d] * 90U);
+            TEST_RUN(TEST_RotateImage(formats[f], degrees[d]));
+            TEST_RUN(TEST_RotateRect(formats[f], degrees[d]));
+        }
+    }
+
+    return TEST_RESULT();
+}
@@ -95,6 +95,12 @@ status_t DC_FB_ELCDIF_Init(const dc_fb_t *dc)
         dcHandle->width  = dcConfig->width;
         dcHandle->elcdif = dcConfig->elcdif;
 
+        for (uint8_t i = 0; i < DC_FB_ELCDIF_MAX_LAYER; i++)
+        {
+            (void)VIDEO_RINGBUF_Init(&dcHandle->layers[i].frameQueue, dcHandle->layers[i].frameQueueBuf,
+                                     DC_FB_ELCDIF_FRAME_QUEUE_SIZE + 1U);
+        }
+
         ELCDIF_RgbModeInit(dcHandle->elcdif, &elcdifConfig);
     }
 
@@ -153,6 +159,10 @@ status_t DC_FB_ELCDIF_DisableLayer(const dc_fb_t *dc, uint8_t layer)
         ELCDIF_RgbModeStop(dcHandle->elcdif);
         dcHandle->layers[layer].enabled = false;
         ELCDIF_DisableInterrupts(dcHandle->elcdif, (uint32_t)kELCDIF_CurFrameDoneInterruptEnable);
+
+        /* The queued frames are discarded, they are not shown. */
+        (void)VIDEO_RINGBUF_Init(&dcHandle->layers[layer].frameQueue, dcHandle->layers[layer].frameQueueBuf,
+                                 DC_FB_ELCDIF_FRAME_QUEUE_SIZE + 1U);
     }
 
     return kStatus_Success;
@@ -204,27 +214,49 @@ status_t DC_FB_ELCDIF_SetFrameBuffer(const dc_fb_t *dc, uint8_t layer, void *fra
 {
     assert(layer < DC_FB_ELCDIF_MAX_LAYER);
     dc_fb_elcdif_handle_t *dcHandle = dc->prvData;
-
-    ELCDIF_SetNextBufferAddr(dcHandle->elcdif, (uint32_t)(uint8_t *)frameBuffer);
-    dcHandle->layers[layer].inactiveBuffer = frameBuffer;
+    dc_fb_elcdif_layer_t *pLayer    = &dcHandle->layers[layer];
+    status_t status                 = kStatus_Success;
+    uint32_t regPrimask;
 
     /*
      * If the layer is not started, set the current buffer and next buffer to
      * new frame buffer, there is not pending frame.
      * If the layer already started, only set the next buffer, and the new frameBuffer
-     * is pending until current buffer switched out.
+     * is pending until current buffer switched out. If there is pending frame
+     * already, the new frameBuffer is queued, and set to next buffer in ISR.
      */
-    if (!dcHandle->layers[layer].enabled)
+    if (!pLayer->enabled)
     {
-        dcHandle->elcdif->CUR_BUF            = ELCDIF_ADDR_CPU_2_IP((uint32_t)(uint8_t *)frameBuffer);
-        dcHandle->layers[layer].activeBuffer = frameBuffer;
+        ELCDIF_SetNextBufferAddr(dcHandle->elcdif, (uint32_t)(uint8_t *)frameBuffer);
+        dcHandle->elcdif->CUR_BUF = ELCDIF_ADDR_CPU_2_IP((uint32_t)(uint8_t *)frameBuffer);
+        pLayer->inactiveBuffer    = frameBuffer;
+        pLayer->activeBuffer      = frameBuffer;
     }
     else
     {
-        dcHandle->layers[layer].framePending = true;
+        /* The frame queue is also accessed in ISR. */
+        regPrimask = DisableGlobalIRQ();
+
+        if (!pLayer->framePending)
+        {
+            ELCDIF_SetNextBufferAddr(dcHandle->elcdif, (uint32_t)(uint8_t *)frameBuffer);
+            pLayer->inactiveBuffer = frameBuffer;
+            pLayer->framePending   = true;
+        }
+        else if (kStatus_Success == VIDEO_RINGBUF_Put(&pLayer->frameQueue, frameBuffer))
+        {
+            pLayer->stat.lateFrames++;
+        }
+        else
+        {
+            pLayer->stat.droppedFrames++;
+            status = kStatus_Fail;
+        }
+
+        EnableGlobalIRQ(regPrimask);
     }
 
-    return kStatus_Success;
+    return status;
 }
 
 void DC_FB_ELCDIF_SetCallback(const dc_fb_t *dc, uint8_t layer, dc_fb_callback_t callback, void *param)
@@ -241,11 +273,20 @@ uint32_t DC_FB_ELCDIF_GetProperty(const dc_fb_t *dc)
     return (uint32_t)kDC_FB_ReserveFrameBuffer;
 }
 
+void DC_FB_ELCDIF_GetFrameStatistics(const dc_fb_t *dc, uint8_t layer, dc_fb_elcdif_frame_stat_t *stat)
+{
+    assert(layer < DC_FB_ELCDIF_MAX_LAYER);
+    dc_fb_elcdif_handle_t *dcHandle = dc->prvData;
+
+    *stat = dcHandle->layers[layer].stat;
+}
+
 void DC_FB_ELCDIF_IRQHandler(const dc_fb_t *dc)
 {
     dc_fb_elcdif_handle_t *dcHandle = dc->prvData;
     dc_fb_elcdif_layer_t *layer;
     void *oldActiveBuffer;
+    void *nextBuffer;
     ELCDIF_ClearInterruptStatus(dcHandle->elcdif, (uint32_t)kELCDIF_CurFrameDone);
 
     for (uint8_t i = 0; i < DC_FB_ELCDIF_MAX_LAYER; i++)
@@ -257,6 +298,15 @@ void DC_FB_ELCDIF_IRQHandler(const dc_fb_t *dc)
             oldActiveBuffer                  = layer->activeBuffer;
             layer->activeBuffer              = layer->inactiveBuffer;
             dcHandle->layers[i].framePending = false;
+            layer->stat.shownFrames++;
+
+            /* Set the next queued frame, it is shown after current frame done. */
+            if (kStatus_Success == VIDEO_RINGBUF_Get(&layer->frameQueue, &nextBuffer))
+            {
+                ELCDIF_SetNextBufferAddr(dcHandle->elcdif, (uint32_t)(uint8_t *)nextBuffer);
+                layer->inactiveBuffer = nextBuffer;
+                layer->framePending   = true;
+            }
 
             layer->callback(layer->cbParam, oldActiveBuffer);
         }
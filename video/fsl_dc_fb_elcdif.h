@@ -14,6 +14,10 @@
 /*
  * Change log:
  *
+ *   1.1.0
+ *     - Add frame queue, more than one frame could be pending.
+ *     - Add dropped and late frame statistics.
+ *
  *   1.0.1
  *     - Fixed MISRA-C 2012 issues.
  *
@@ -34,15 +38,34 @@
 #define DC_FB_ELCDIF_DEFAULT_PIXEL_FORMAT        kVIDEO_PixelFormatRGB565
 #define DC_FB_ELCDIF_DEFAULT_PIXEL_FORMAT_ELCDIF kELCDIF_PixelFormatRGB565
 
+/*
+ * Frames could be queued after the pending frame. The queued frames are shown
+ * one by one at the following frame done.
+ */
+#ifndef DC_FB_ELCDIF_FRAME_QUEUE_SIZE
+#define DC_FB_ELCDIF_FRAME_QUEUE_SIZE 2U
+#endif
+
+/*! @brief Frame statistics of ELCDIF display controller layer. */
+typedef struct _dc_fb_elcdif_frame_stat
+{
+    uint32_t shownFrames;   /*!< Frames switched in. */
+    uint32_t droppedFrames; /*!< Frames rejected because the frame queue is full. */
+    uint32_t lateFrames;    /*!< Frames missed the next frame done because of earlier pending frames. */
+} dc_fb_elcdif_frame_stat_t;
+
 /*! @brief Data for ELCDIF display controller layer. */
 typedef struct _dc_fb_elcdif_layer
 {
-    bool enabled;               /*!< The layer is enabled. */
-    volatile bool framePending; /*!< New frame pending. */
-    void *activeBuffer;         /*!< The frame buffer which is shown. */
-    void *inactiveBuffer;       /*!< The frame buffer which will be shown. */
-    dc_fb_callback_t callback;  /*!< Callback for buffer switch off. */
-    void *cbParam;              /*!< Callback parameter. */
+    bool enabled;                                            /*!< The layer is enabled. */
+    volatile bool framePending;                              /*!< New frame pending. */
+    void *activeBuffer;                                      /*!< The frame buffer which is shown. */
+    void *inactiveBuffer;                                    /*!< The frame buffer which will be shown. */
+    dc_fb_callback_t callback;                               /*!< Callback for buffer switch off. */
+    void *cbParam;                                           /*!< Callback parameter. */
+    video_ringbuf_t frameQueue;                              /*!< Frames waiting after the pending frame. */
+    void *frameQueueBuf[DC_FB_ELCDIF_FRAME_QUEUE_SIZE + 1U]; /*!< Frame queue memory, one room is reserved. */
+    dc_fb_elcdif_frame_stat_t stat;                          /*!< Frame statistics. */
 } dc_fb_elcdif_layer_t;
 
 /*! @brief Data for ELCDIF display controller driver handle. */
@@ -91,6 +114,7 @@ status_t DC_FB_ELCDIF_SetFrameBuffer(const dc_fb_t *dc, uint8_t layer, void *fra
 uint32_t DC_FB_ELCDIF_GetProperty(const dc_fb_t *dc);
 void DC_FB_ELCDIF_SetCallback(const dc_fb_t *dc, uint8_t layer, dc_fb_callback_t callback, void *param);
 void DC_FB_ELCDIF_IRQHandler(const dc_fb_t *dc);
+void DC_FB_ELCDIF_GetFrameStatistics(const dc_fb_t *dc, uint8_t layer, dc_fb_elcdif_frame_stat_t *stat);
 
 #if defined(__cplusplus)
 }
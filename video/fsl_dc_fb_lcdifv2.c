@@ -36,6 +36,7 @@ typedef struct
  * Prototypes
  ******************************************************************************/
 static status_t DC_FB_LCDIFV2_GetPixelFormat(video_pixel_format_t input, lcdifv2_pixel_format_t *output);
+static void DC_FB_LCDIFV2_LoadFrameBuffer(dc_fb_lcdifv2_handle_t *dcHandle, uint8_t layer, void *frameBuffer);
 
 /*******************************************************************************
  * Variables
@@ -68,6 +69,16 @@ static status_t DC_FB_LCDIFV2_GetPixelFormat(video_pixel_format_t input, lcdifv2
     return kStatus_InvalidArgument;
 }
 
+/* Load the frame buffer, it is shown after next vertical blanking. */
+static void DC_FB_LCDIFV2_LoadFrameBuffer(dc_fb_lcdifv2_handle_t *dcHandle, uint8_t layer, void *frameBuffer)
+{
+    LCDIFV2_SetLayerBufferAddr(dcHandle->lcdifv2, layer, (uint32_t)(uint8_t *)frameBuffer);
+    LCDIFV2_TriggerLayerShadowLoad(dcHandle->lcdifv2, layer);
+    dcHandle->layers[layer].inactiveBuffer    = frameBuffer;
+    dcHandle->layers[layer].shadowLoadPending = true;
+    dcHandle->layers[layer].framePending      = true;
+}
+
 status_t DC_FB_LCDIFV2_Init(const dc_fb_t *dc)
 {
     status_t status = kStatus_Success;
@@ -99,6 +110,12 @@ status_t DC_FB_LCDIFV2_Init(const dc_fb_t *dc)
         dcHandle->lcdifv2 = dcConfig->lcdifv2;
         dcHandle->domain  = dcConfig->domain;
 
+        for (uint8_t i = 0; i < DC_FB_LCDIFV2_MAX_LAYER; i++)
+        {
+            (void)VIDEO_RINGBUF_Init(&dcHandle->layers[i].frameQueue, dcHandle->layers[i].frameQueueBuf,
+                                     DC_FB_LCDIFV2_FRAME_QUEUE_SIZE + 1U);
+        }
+
         LCDIFV2_Init(dcHandle->lcdifv2);
 
         LCDIFV2_SetDisplayConfig(dcHandle->lcdifv2, &lcdifv2Config);
@@ -168,6 +185,10 @@ status_t DC_FB_LCDIFV2_DisableLayer(const dc_fb_t *dc, uint8_t layer)
         LCDIFV2_EnableLayer(dcHandle->lcdifv2, layer, false);
         LCDIFV2_TriggerLayerShadowLoad(dcHandle->lcdifv2, layer);
         dcHandle->layers[layer].enabled = false;
+
+        /* The queued frames are discarded, they are not shown. */
+        (void)VIDEO_RINGBUF_Init(&dcHandle->layers[layer].frameQueue, dcHandle->layers[layer].frameQueueBuf,
+                                 DC_FB_LCDIFV2_FRAME_QUEUE_SIZE + 1U);
     }
 
     return kStatus_Success;
@@ -222,21 +243,39 @@ status_t DC_FB_LCDIFV2_SetFrameBuffer(const dc_fb_t *dc, uint8_t layer, void *fr
 {
     assert(layer < DC_FB_LCDIFV2_MAX_LAYER);
     dc_fb_lcdifv2_handle_t *dcHandle = dc->prvData;
+    dc_fb_lcdifv2_layer_t *pLayer    = &dcHandle->layers[layer];
+    status_t status                  = kStatus_Success;
+    uint32_t regPrimask;
 
-    LCDIFV2_SetLayerBufferAddr(dcHandle->lcdifv2, layer, (uint32_t)(uint8_t *)frameBuffer);
-    dcHandle->layers[layer].inactiveBuffer = frameBuffer;
-
-    if (dcHandle->layers[layer].enabled)
+    if (pLayer->enabled)
     {
-        LCDIFV2_TriggerLayerShadowLoad(dcHandle->lcdifv2, layer);
-        dcHandle->layers[layer].shadowLoadPending = true;
-        dcHandle->layers[layer].framePending      = true;
+        /* The frame queue is also accessed in ISR. */
+        regPrimask = DisableGlobalIRQ();
+
+        if (!pLayer->framePending)
+        {
+            DC_FB_LCDIFV2_LoadFrameBuffer(dcHandle, layer, frameBuffer);
+        }
+        /* Another frame is pending, this frame can't be shown at next vertical blanking. */
+        else if (kStatus_Success == VIDEO_RINGBUF_Put(&pLayer->frameQueue, frameBuffer))
+        {
+            pLayer->stat.lateFrames++;
+        }
+        else
+        {
+            pLayer->stat.droppedFrames++;
+            status = kStatus_Fail;
+        }
+
+        EnableGlobalIRQ(regPrimask);
     }
     else
     {
+        LCDIFV2_SetLayerBufferAddr(dcHandle->lcdifv2, layer, (uint32_t)(uint8_t *)frameBuffer);
+        pLayer->inactiveBuffer = frameBuffer;
     }
 
-    return kStatus_Success;
+    return status;
 }
 
 void DC_FB_LCDIFV2_SetCallback(const dc_fb_t *dc, uint8_t layer, dc_fb_callback_t callback, void *param)
@@ -253,12 +292,78 @@ uint32_t DC_FB_LCDIFV2_GetProperty(const dc_fb_t *dc)
     return (uint32_t)kDC_FB_ReserveFrameBuffer;
 }
 
+void DC_FB_LCDIFV2_GetFrameStatistics(const dc_fb_t *dc, uint8_t layer, dc_fb_lcdifv2_frame_stat_t *stat)
+{
+    assert(layer < DC_FB_LCDIFV2_MAX_LAYER);
+    dc_fb_lcdifv2_handle_t *dcHandle = dc->prvData;
+
+    *stat = dcHandle->layers[layer].stat;
+}
+
+void DC_FB_LCDIFV2_SetVsyncCallback(const dc_fb_t *dc, dc_fb_lcdifv2_vsync_callback_t callback, void *param)
+{
+    dc_fb_lcdifv2_handle_t *dcHandle = dc->prvData;
+    uint32_t regPrimask;
+
+    regPrimask = DisableGlobalIRQ();
+
+    dcHandle->vsyncCallback = callback;
+    dcHandle->vsyncParam    = param;
+
+    EnableGlobalIRQ(regPrimask);
+}
+
+status_t DC_FB_LCDIFV2_SetLayerBlend(const dc_fb_t *dc, uint8_t layer, const lcdifv2_blend_config_t *config)
+{
+    assert(layer < DC_FB_LCDIFV2_MAX_LAYER);
+    dc_fb_lcdifv2_handle_t *dcHandle = dc->prvData;
+    uint32_t regPrimask;
+
+    /* The layer registers are also updated in ISR when loading queued frame. */
+    regPrimask = DisableGlobalIRQ();
+
+    LCDIFV2_SetLayerBlendConfig(dcHandle->lcdifv2, layer, config);
+
+    if (dcHandle->layers[layer].enabled)
+    {
+        LCDIFV2_TriggerLayerShadowLoad(dcHandle->lcdifv2, layer);
+        dcHandle->layers[layer].shadowLoadPending = true;
+    }
+
+    EnableGlobalIRQ(regPrimask);
+
+    return kStatus_Success;
+}
+
+status_t DC_FB_LCDIFV2_SetLayerOffset(const dc_fb_t *dc, uint8_t layer, uint16_t offsetX, uint16_t offsetY)
+{
+    assert(layer < DC_FB_LCDIFV2_MAX_LAYER);
+    dc_fb_lcdifv2_handle_t *dcHandle = dc->prvData;
+    uint32_t regPrimask;
+
+    /* The layer registers are also updated in ISR when loading queued frame. */
+    regPrimask = DisableGlobalIRQ();
+
+    LCDIFV2_SetLayerOffset(dcHandle->lcdifv2, layer, offsetX, offsetY);
+
+    if (dcHandle->layers[layer].enabled)
+    {
+        LCDIFV2_TriggerLayerShadowLoad(dcHandle->lcdifv2, layer);
+        dcHandle->layers[layer].shadowLoadPending = true;
+    }
+
+    EnableGlobalIRQ(regPrimask);
+
+    return kStatus_Success;
+}
+
 void DC_FB_LCDIFV2_IRQHandler(const dc_fb_t *dc)
 {
     uint32_t intStatus;
     dc_fb_lcdifv2_handle_t *dcHandle = dc->prvData;
     dc_fb_lcdifv2_layer_t *layer;
     void *oldActiveBuffer;
+    void *nextBuffer;
 
     intStatus = LCDIFV2_GetInterruptStatus(dcHandle->lcdifv2, dcHandle->domain);
     LCDIFV2_ClearInterruptStatus(dcHandle->lcdifv2, dcHandle->domain, intStatus);
@@ -282,8 +387,20 @@ void DC_FB_LCDIFV2_IRQHandler(const dc_fb_t *dc)
             oldActiveBuffer                  = layer->activeBuffer;
             layer->activeBuffer              = layer->inactiveBuffer;
             dcHandle->layers[i].framePending = false;
+            layer->stat.shownFrames++;
+
+            /* Load the next queued frame, it is shown after next vertical blanking. */
+            if (kStatus_Success == VIDEO_RINGBUF_Get(&layer->frameQueue, &nextBuffer))
+            {
+                DC_FB_LCDIFV2_LoadFrameBuffer(dcHandle, i, nextBuffer);
+            }
 
             layer->callback(layer->cbParam, oldActiveBuffer);
         }
     }
+
+    if (NULL != dcHandle->vsyncCallback)
+    {
+        dcHandle->vsyncCallback(dcHandle->vsyncParam);
+    }
 }
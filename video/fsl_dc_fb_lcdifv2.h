@@ -14,6 +14,16 @@
 /*
  * Change log:
  *
+ *   1.3.0
+ *     - Add layer blend and layer offset setting functions.
+ *
+ *   1.2.0
+ *     - Add vertical blanking callback.
+ *
+ *   1.1.0
+ *     - Add frame queue, more than one frame could be pending.
+ *     - Add dropped and late frame statistics.
+ *
  *   1.0.2
  *     - Add more pixel format support.
  *
@@ -39,6 +49,22 @@
 #define DC_FB_LCDIFV2_DEFAULT_PIXEL_FORMAT_LCDIFV2 kLCDIFV2_PixelFormatRGB565
 #define DC_FB_LCDIFV2_DEFAULT_BYTE_PER_PIXEL       2U
 
+/*
+ * Frames could be queued after the pending frame. The queued frames are shown
+ * one by one at the following vertical blankings.
+ */
+#ifndef DC_FB_LCDIFV2_FRAME_QUEUE_SIZE
+#define DC_FB_LCDIFV2_FRAME_QUEUE_SIZE 2U
+#endif
+
+/*! @brief Frame statistics of LCDIFV2 display controller layer. */
+typedef struct _dc_fb_lcdifv2_frame_stat
+{
+    uint32_t shownFrames;   /*!< Frames switched in. */
+    uint32_t droppedFrames; /*!< Frames rejected because the frame queue is full. */
+    uint32_t lateFrames;    /*!< Frames missed the next vertical blanking because of earlier pending frames. */
+} dc_fb_lcdifv2_frame_stat_t;
+
 /*! @brief Data for LCDIFV2 display controller layer. */
 typedef struct _dc_fb_lcdifv2_layer
 {
@@ -49,8 +75,18 @@ typedef struct _dc_fb_lcdifv2_layer
     void *inactiveBuffer;            /*!< The frame buffer which will be shown. */
     dc_fb_callback_t callback;       /*!< Callback for buffer switch off. */
     void *cbParam;                   /*!< Callback parameter. */
+    video_ringbuf_t frameQueue;      /*!< Frames waiting after the pending frame. */
+    void *frameQueueBuf[DC_FB_LCDIFV2_FRAME_QUEUE_SIZE + 1U]; /*!< Frame queue memory, one room is reserved. */
+    dc_fb_lcdifv2_frame_stat_t stat;                          /*!< Frame statistics. */
 } dc_fb_lcdifv2_layer_t;
 
+/*!
+ * @brief Callback function invoked at every vertical blanking.
+ *
+ * It is called in ISR, after the pending frames are switched in.
+ */
+typedef void (*dc_fb_lcdifv2_vsync_callback_t)(void *param);
+
 /*! @brief Data for LCDIFV2 display controller driver handle. */
 typedef struct _dc_fb_lcdifv2_handle
 {
@@ -60,6 +96,8 @@ typedef struct _dc_fb_lcdifv2_handle
     uint16_t width;                                        /*!< Panel width. */
     uint8_t domain;                                        /*!< Domain used for interrupt. */
     dc_fb_lcdifv2_layer_t layers[DC_FB_LCDIFV2_MAX_LAYER]; /*!< Information of the layer. */
+    dc_fb_lcdifv2_vsync_callback_t vsyncCallback;          /*!< Callback for vertical blanking. */
+    void *vsyncParam;                                      /*!< Vertical blanking callback parameter. */
 } dc_fb_lcdifv2_handle_t;
 
 /*! @brief Configuration for LCDIFV2 display controller driver handle. */
@@ -100,6 +138,54 @@ uint32_t DC_FB_LCDIFV2_GetProperty(const dc_fb_t *dc);
 void DC_FB_LCDIFV2_SetCallback(const dc_fb_t *dc, uint8_t layer, dc_fb_callback_t callback, void *param);
 void DC_FB_LCDIFV2_IRQHandler(const dc_fb_t *dc);
 
+/*!
+ * @brief Get the frame statistics of the layer.
+ *
+ * @param dc Pointer to the display controller.
+ * @param layer Layer index.
+ * @param stat Pointer to the statistics.
+ */
+void DC_FB_LCDIFV2_GetFrameStatistics(const dc_fb_t *dc, uint8_t layer, dc_fb_lcdifv2_frame_stat_t *stat);
+
+/*!
+ * @brief Set the callback invoked at every vertical blanking.
+ *
+ * The vertical blanking interrupt is enabled once the display controller is
+ * initialized, so the callback could be used as the display heartbeat.
+ *
+ * @param dc Pointer to the display controller.
+ * @param callback The callback, NULL to disable.
+ * @param param Parameter passed to the callback.
+ */
+void DC_FB_LCDIFV2_SetVsyncCallback(const dc_fb_t *dc, dc_fb_lcdifv2_vsync_callback_t callback, void *param);
+
+/*!
+ * @brief Set the alpha blend configuration of the layer.
+ *
+ * If the layer is enabled, the new configuration takes effect after next
+ * vertical blanking, together with the pending frame if there is.
+ *
+ * @param dc Pointer to the display controller.
+ * @param layer Layer index.
+ * @param config Pointer to the blend configuration.
+ * @return kStatus_Success.
+ */
+status_t DC_FB_LCDIFV2_SetLayerBlend(const dc_fb_t *dc, uint8_t layer, const lcdifv2_blend_config_t *config);
+
+/*!
+ * @brief Move the layer in the panel.
+ *
+ * If the layer is enabled, the new position takes effect after next
+ * vertical blanking, together with the pending frame if there is.
+ *
+ * @param dc Pointer to the display controller.
+ * @param layer Layer index.
+ * @param offsetX Horizontal offset of the layer in the panel.
+ * @param offsetY Vertical offset of the layer in the panel.
+ * @return kStatus_Success.
+ */
+status_t DC_FB_LCDIFV2_SetLayerOffset(const dc_fb_t *dc, uint8_t layer, uint16_t offsetX, uint16_t offsetY);
+
 #if defined(__cplusplus)
 }
 #endif